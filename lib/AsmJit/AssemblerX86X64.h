@@ -4954,6 +4954,18 @@ struct ASMJIT_HIDDEN AssemblerIntrinsics : public AssemblerCore
     _emitInstruction(INST_CLFLUSH, &mem);
   }
 
+  //! @brief Flush Cache Line Optimized (CLFLUSHOPT).
+  inline void clflushopt(const Mem& mem)
+  {
+    _emitInstruction(INST_CLFLUSHOPT, &mem);
+  }
+
+  //! @brief Cache Line Write Back (CLWB).
+  inline void clwb(const Mem& mem)
+  {
+    _emitInstruction(INST_CLWB, &mem);
+  }
+
   //! @brief Packed DP-FP Compare (SSE2).
   inline void cmppd(const XMMReg& dst, const XMMReg& src, const Imm& imm8)
   {
@@ -6902,6 +6902,7 @@ CompilerCore::CompilerCore(CodeGenerator* codeGenerator) ASMJIT_NOTHROW :
   _zone(16384 - sizeof(Zone::Chunk) - 32),
   _logger(NULL),
   _error(0),
+  _codeSize(0),
   _properties((1 << PROPERTY_OPTIMIZE_ALIGN)),
   _emitOptions(0),
   _finished(false),
@@ -7612,6 +7613,7 @@ void* CompilerCore::make() ASMJIT_NOTHROW
   }
 
   void* result = a.make();
+  if (result) _codeSize = a.getCodeSize();
   if (_logger)
   {
     _logger->logFormat("*** COMPILER SUCCESS - Wrote %u bytes, code: %u, trampolines: %u.\n\n",
@@ -2050,6 +2050,10 @@ struct ASMJIT_API CompilerCore
   //! error value remains the same.
   virtual void* make() ASMJIT_NOTHROW;
 
+  //! @brief Get size of the code generated by the last @c make() call,
+  //! including trampolines (zero if nothing was made yet).
+  inline sysuint_t getCodeSize() const ASMJIT_NOTHROW { return _codeSize; }
+
   //! @brief Method that will emit everything to @c Assembler instance @a a.
   virtual void serialize(Assembler& a) ASMJIT_NOTHROW;
 
@@ -2084,6 +2088,9 @@ protected:
   //! @brief Last error code.
   uint32_t _error;
 
+  //! @brief Size of the code generated by the last @c make() call.
+  sysuint_t _codeSize;
+
   //! @brief Properties.
   uint32_t _properties;
 
@@ -5733,6 +5740,18 @@ struct ASMJIT_HIDDEN CompilerIntrinsics : public CompilerCore
     _emitInstruction(INST_CLFLUSH, &mem);
   }
 
+  //! @brief Flush Cache Line Optimized (CLFLUSHOPT).
+  inline void clflushopt(const Mem& mem)
+  {
+    _emitInstruction(INST_CLFLUSHOPT, &mem);
+  }
+
+  //! @brief Cache Line Write Back (CLWB).
+  inline void clwb(const Mem& mem)
+  {
+    _emitInstruction(INST_CLWB, &mem);
+  }
+
   //! @brief Packed DP-FP Compare (SSE2).
   inline void cmppd(const XMMVar& dst, const XMMVar& src, const Imm& imm8)
   {
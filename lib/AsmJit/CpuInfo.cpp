@@ -85,8 +85,12 @@ void cpuid(uint32_t in, CpuId* out) ASMJIT_NOTHROW
 // 2009-02-05: Thanks to Mike Tajmajer for supporting VC7.1 compiler.
 // ASMJIT_X64 is here only for readibility, only VS2005 can compile 64-bit code.
 # if _MSC_VER >= 1400 || defined(ASMJIT_X64)
-  // done by intrinsics
+  // done by intrinsics, __cpuidex (VS2008+) also clears the subleaf in ecx
+#  if _MSC_VER >= 1500
+  __cpuidex(reinterpret_cast<int*>(out->i), in, 0);
+#  else
   __cpuid(reinterpret_cast<int*>(out->i), in);
+#  endif
 # else // _MSC_VER < 1400
   uint32_t cpuid_in = in;
   uint32_t* cpuid_out = out->i;
@@ -94,6 +98,7 @@ void cpuid(uint32_t in, CpuId* out) ASMJIT_NOTHROW
   __asm
   {
     mov     eax, cpuid_in
+    xor     ecx, ecx
     mov     edi, cpuid_out
     cpuid
     mov     dword ptr[edi +  0], eax
@@ -111,13 +116,13 @@ void cpuid(uint32_t in, CpuId* out) ASMJIT_NOTHROW
   asm ("mov %%ebx, %%edi\n"    \
        "cpuid\n"               \
        "xchg %%edi, %%ebx\n"   \
-       : "=a" (a), "=D" (b), "=c" (c), "=d" (d) : "a" (inp))
+       : "=a" (a), "=D" (b), "=c" (c), "=d" (d) : "a" (inp), "2" (0))
 # else
 #  define __mycpuid(a, b, c, d, inp) \
   asm ("mov %%rbx, %%rdi\n"    \
        "cpuid\n"               \
        "xchg %%rdi, %%rbx\n"   \
-       : "=a" (a), "=D" (b), "=c" (c), "=d" (d) : "a" (inp))
+       : "=a" (a), "=D" (b), "=c" (c), "=d" (d) : "a" (inp), "2" (0))
 # endif
   __mycpuid(out->eax, out->ebx, out->ecx, out->edx, in);
 
@@ -253,6 +258,7 @@ void detectCpuInfo(CpuInfo* i) ASMJIT_NOTHROW
   if (out.edx & 0x00000010U) i->features |= CPU_FEATURE_RDTSC;
   if (out.edx & 0x00000100U) i->features |= CPU_FEATURE_CMPXCHG8B;
   if (out.edx & 0x00008000U) i->features |= CPU_FEATURE_CMOV;
+  if (out.edx & 0x00080000U) i->features |= CPU_FEATURE_CLFLUSH;
   if (out.edx & 0x00800000U) i->features |= CPU_FEATURE_MMX;
   if (out.edx & 0x01000000U) i->features |= CPU_FEATURE_FXSR;
   if (out.edx & 0x02000000U) i->features |= CPU_FEATURE_SSE | CPU_FEATURE_MMX_EXT;
@@ -278,13 +284,24 @@ void detectCpuInfo(CpuInfo* i) ASMJIT_NOTHROW
     i->bugs |= CPU_BUG_AMD_LOCK_MB;
   }
 
+  // Structured extended feature flags (leaf 7, subleaf 0). The subleaf is
+  // passed in ecx, which cpuid() always clears.
+  cpuid(0, &out);
+  if (out.eax >= 7)
+  {
+    cpuid(7, &out);
+
+    if (out.ebx & 0x00800000U) i->extendedFeatures |= CPU_EXTENDED_FEATURE_CLFLUSHOPT;
+    if (out.ebx & 0x01000000U) i->extendedFeatures |= CPU_EXTENDED_FEATURE_CLWB;
+  }
+
   // Calling cpuid with 0x80000000 as the in argument
   // gets the number of valid extended IDs.
 
   cpuid(0x80000000, &out);
 
   uint32_t exIds = out.eax;
-  if (exIds > 0x80000004) exIds = 0x80000004;
+  if (exIds > 0x80000007) exIds = 0x80000007;
 
   uint32_t* brand = reinterpret_cast<uint32_t*>(i->brand);
 
@@ -319,6 +336,10 @@ void detectCpuInfo(CpuInfo* i) ASMJIT_NOTHROW
         *brand++ = out.edx;
         break;
 
+      case 0x80000007:
+        if (out.edx & 0x00000100U) i->extendedFeatures |= CPU_EXTENDED_FEATURE_INVARIANT_TSC;
+        break;
+
       default:
         // Additional features can be detected in the future.
         break;
@@ -166,6 +166,21 @@ enum CPU_FEATURE
   CPU_FEATURE_64_BIT = 1U << 31
 };
 
+// ============================================================================
+// [AsmJit::CPU_EXTENDED_FEATURE]
+// ============================================================================
+
+//! @brief X86/X64 CPU extended features (cpuid leaves 7 and 0x80000007).
+enum CPU_EXTENDED_FEATURE
+{
+  //! @brief Cpu has CLFLUSHOPT instruction.
+  CPU_EXTENDED_FEATURE_CLFLUSHOPT = 1U << 0,
+  //! @brief Cpu has CLWB instruction.
+  CPU_EXTENDED_FEATURE_CLWB = 1U << 1,
+  //! @brief Cpu has invariant TSC (constant rate in all P-, C- and T-states).
+  CPU_EXTENDED_FEATURE_INVARIANT_TSC = 1U << 2
+};
+
 // ============================================================================
 // [AsmJit::CPU_BUG]
 // ============================================================================
@@ -201,6 +216,8 @@ struct ASMJIT_HIDDEN CpuInfo
   uint32_t numberOfProcessors;
   //! @brief Cpu features bitfield, see @c AsmJit::CpuInfo::Feature enum).
   uint32_t features;
+  //! @brief Cpu extended features bitfield, see @c AsmJit::CPU_EXTENDED_FEATURE enum).
+  uint32_t extendedFeatures;
   //! @brief Cpu bugs bitfield, see @c AsmJit::CpuInfo::Bug enum).
   uint32_t bugs;
 
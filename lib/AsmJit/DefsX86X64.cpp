@@ -135,6 +135,8 @@ const char instructionName[] =
   "clc\0"
   "cld\0"
   "clflush\0"
+  "clflushopt\0"
+  "clwb\0"
   "cmc\0"
   "cmova\0"
   "cmovae\0"
@@ -712,549 +714,551 @@ const char instructionName[] =
 #define INST_CLC_INDEX 184
 #define INST_CLD_INDEX 188
 #define INST_CLFLUSH_INDEX 192
-#define INST_CMC_INDEX 200
-#define INST_CMOVA_INDEX 204
-#define INST_CMOVAE_INDEX 210
-#define INST_CMOVB_INDEX 217
-#define INST_CMOVBE_INDEX 223
-#define INST_CMOVC_INDEX 230
-#define INST_CMOVE_INDEX 236
-#define INST_CMOVG_INDEX 242
-#define INST_CMOVGE_INDEX 248
-#define INST_CMOVL_INDEX 255
-#define INST_CMOVLE_INDEX 261
-#define INST_CMOVNA_INDEX 268
-#define INST_CMOVNAE_INDEX 275
-#define INST_CMOVNB_INDEX 283
-#define INST_CMOVNBE_INDEX 290
-#define INST_CMOVNC_INDEX 298
-#define INST_CMOVNE_INDEX 305
-#define INST_CMOVNG_INDEX 312
-#define INST_CMOVNGE_INDEX 319
-#define INST_CMOVNL_INDEX 327
-#define INST_CMOVNLE_INDEX 334
-#define INST_CMOVNO_INDEX 342
-#define INST_CMOVNP_INDEX 349
-#define INST_CMOVNS_INDEX 356
-#define INST_CMOVNZ_INDEX 363
-#define INST_CMOVO_INDEX 370
-#define INST_CMOVP_INDEX 376
-#define INST_CMOVPE_INDEX 382
-#define INST_CMOVPO_INDEX 389
-#define INST_CMOVS_INDEX 396
-#define INST_CMOVZ_INDEX 402
-#define INST_CMP_INDEX 408
-#define INST_CMPPD_INDEX 412
-#define INST_CMPPS_INDEX 418
-#define INST_CMPSD_INDEX 424
-#define INST_CMPSS_INDEX 430
-#define INST_CMPXCHG_INDEX 436
-#define INST_CMPXCHG16B_INDEX 444
-#define INST_CMPXCHG8B_INDEX 455
-#define INST_COMISD_INDEX 465
-#define INST_COMISS_INDEX 472
-#define INST_CPUID_INDEX 479
-#define INST_CRC32_INDEX 485
-#define INST_CVTDQ2PD_INDEX 491
-#define INST_CVTDQ2PS_INDEX 500
-#define INST_CVTPD2DQ_INDEX 509
-#define INST_CVTPD2PI_INDEX 518
-#define INST_CVTPD2PS_INDEX 527
-#define INST_CVTPI2PD_INDEX 536
-#define INST_CVTPI2PS_INDEX 545
-#define INST_CVTPS2DQ_INDEX 554
-#define INST_CVTPS2PD_INDEX 563
-#define INST_CVTPS2PI_INDEX 572
-#define INST_CVTSD2SI_INDEX 581
-#define INST_CVTSD2SS_INDEX 590
-#define INST_CVTSI2SD_INDEX 599
-#define INST_CVTSI2SS_INDEX 608
-#define INST_CVTSS2SD_INDEX 617
-#define INST_CVTSS2SI_INDEX 626
-#define INST_CVTTPD2DQ_INDEX 635
-#define INST_CVTTPD2PI_INDEX 645
-#define INST_CVTTPS2DQ_INDEX 655
-#define INST_CVTTPS2PI_INDEX 665
-#define INST_CVTTSD2SI_INDEX 675
-#define INST_CVTTSS2SI_INDEX 685
-#define INST_CWDE_INDEX 695
-#define INST_DAA_INDEX 700
-#define INST_DAS_INDEX 704
-#define INST_DEC_INDEX 708
-#define INST_DIV_INDEX 712
-#define INST_DIVPD_INDEX 716
-#define INST_DIVPS_INDEX 722
-#define INST_DIVSD_INDEX 728
-#define INST_DIVSS_INDEX 734
-#define INST_DPPD_INDEX 740
-#define INST_DPPS_INDEX 745
-#define INST_EMMS_INDEX 750
-#define INST_ENTER_INDEX 755
-#define INST_EXTRACTPS_INDEX 761
-#define INST_F2XM1_INDEX 771
-#define INST_FABS_INDEX 777
-#define INST_FADD_INDEX 782
-#define INST_FADDP_INDEX 787
-#define INST_FBLD_INDEX 793
-#define INST_FBSTP_INDEX 798
-#define INST_FCHS_INDEX 804
-#define INST_FCLEX_INDEX 809
-#define INST_FCMOVB_INDEX 815
-#define INST_FCMOVBE_INDEX 822
-#define INST_FCMOVE_INDEX 830
-#define INST_FCMOVNB_INDEX 837
-#define INST_FCMOVNBE_INDEX 845
-#define INST_FCMOVNE_INDEX 854
-#define INST_FCMOVNU_INDEX 862
-#define INST_FCMOVU_INDEX 870
-#define INST_FCOM_INDEX 877
-#define INST_FCOMI_INDEX 882
-#define INST_FCOMIP_INDEX 888
-#define INST_FCOMP_INDEX 895
-#define INST_FCOMPP_INDEX 901
-#define INST_FCOS_INDEX 908
-#define INST_FDECSTP_INDEX 913
-#define INST_FDIV_INDEX 921
-#define INST_FDIVP_INDEX 926
-#define INST_FDIVR_INDEX 932
-#define INST_FDIVRP_INDEX 938
-#define INST_FEMMS_INDEX 945
-#define INST_FFREE_INDEX 951
-#define INST_FIADD_INDEX 957
-#define INST_FICOM_INDEX 963
-#define INST_FICOMP_INDEX 969
-#define INST_FIDIV_INDEX 976
-#define INST_FIDIVR_INDEX 982
-#define INST_FILD_INDEX 989
-#define INST_FIMUL_INDEX 994
-#define INST_FINCSTP_INDEX 1000
-#define INST_FINIT_INDEX 1008
-#define INST_FIST_INDEX 1014
-#define INST_FISTP_INDEX 1019
-#define INST_FISTTP_INDEX 1025
-#define INST_FISUB_INDEX 1032
-#define INST_FISUBR_INDEX 1038
-#define INST_FLD_INDEX 1045
-#define INST_FLD1_INDEX 1049
-#define INST_FLDCW_INDEX 1054
-#define INST_FLDENV_INDEX 1060
-#define INST_FLDL2E_INDEX 1067
-#define INST_FLDL2T_INDEX 1074
-#define INST_FLDLG2_INDEX 1081
-#define INST_FLDLN2_INDEX 1088
-#define INST_FLDPI_INDEX 1095
-#define INST_FLDZ_INDEX 1101
-#define INST_FMUL_INDEX 1106
-#define INST_FMULP_INDEX 1111
-#define INST_FNCLEX_INDEX 1117
-#define INST_FNINIT_INDEX 1124
-#define INST_FNOP_INDEX 1131
-#define INST_FNSAVE_INDEX 1136
-#define INST_FNSTCW_INDEX 1143
-#define INST_FNSTENV_INDEX 1150
-#define INST_FNSTSW_INDEX 1158
-#define INST_FPATAN_INDEX 1165
-#define INST_FPREM_INDEX 1172
-#define INST_FPREM1_INDEX 1178
-#define INST_FPTAN_INDEX 1185
-#define INST_FRNDINT_INDEX 1191
-#define INST_FRSTOR_INDEX 1199
-#define INST_FSAVE_INDEX 1206
-#define INST_FSCALE_INDEX 1212
-#define INST_FSIN_INDEX 1219
-#define INST_FSINCOS_INDEX 1224
-#define INST_FSQRT_INDEX 1232
-#define INST_FST_INDEX 1238
-#define INST_FSTCW_INDEX 1242
-#define INST_FSTENV_INDEX 1248
-#define INST_FSTP_INDEX 1255
-#define INST_FSTSW_INDEX 1260
-#define INST_FSUB_INDEX 1266
-#define INST_FSUBP_INDEX 1271
-#define INST_FSUBR_INDEX 1277
-#define INST_FSUBRP_INDEX 1283
-#define INST_FTST_INDEX 1290
-#define INST_FUCOM_INDEX 1295
-#define INST_FUCOMI_INDEX 1301
-#define INST_FUCOMIP_INDEX 1308
-#define INST_FUCOMP_INDEX 1316
-#define INST_FUCOMPP_INDEX 1323
-#define INST_FWAIT_INDEX 1331
-#define INST_FXAM_INDEX 1337
-#define INST_FXCH_INDEX 1342
-#define INST_FXRSTOR_INDEX 1347
-#define INST_FXSAVE_INDEX 1355
-#define INST_FXTRACT_INDEX 1362
-#define INST_FYL2X_INDEX 1370
-#define INST_FYL2XP1_INDEX 1376
-#define INST_HADDPD_INDEX 1384
-#define INST_HADDPS_INDEX 1391
-#define INST_HSUBPD_INDEX 1398
-#define INST_HSUBPS_INDEX 1405
-#define INST_IDIV_INDEX 1412
-#define INST_IMUL_INDEX 1417
-#define INST_INC_INDEX 1422
-#define INST_INT3_INDEX 1426
-#define INST_JA_INDEX 1431
-#define INST_JAE_INDEX 1434
-#define INST_JB_INDEX 1438
-#define INST_JBE_INDEX 1441
-#define INST_JC_INDEX 1445
-#define INST_JE_INDEX 1448
-#define INST_JG_INDEX 1451
-#define INST_JGE_INDEX 1454
-#define INST_JL_INDEX 1458
-#define INST_JLE_INDEX 1461
-#define INST_JNA_INDEX 1465
-#define INST_JNAE_INDEX 1469
-#define INST_JNB_INDEX 1474
-#define INST_JNBE_INDEX 1478
-#define INST_JNC_INDEX 1483
-#define INST_JNE_INDEX 1487
-#define INST_JNG_INDEX 1491
-#define INST_JNGE_INDEX 1495
-#define INST_JNL_INDEX 1500
-#define INST_JNLE_INDEX 1504
-#define INST_JNO_INDEX 1509
-#define INST_JNP_INDEX 1513
-#define INST_JNS_INDEX 1517
-#define INST_JNZ_INDEX 1521
-#define INST_JO_INDEX 1525
-#define INST_JP_INDEX 1528
-#define INST_JPE_INDEX 1531
-#define INST_JPO_INDEX 1535
-#define INST_JS_INDEX 1539
-#define INST_JZ_INDEX 1542
-#define INST_JMP_INDEX 1545
-#define INST_LDDQU_INDEX 1549
-#define INST_LDMXCSR_INDEX 1555
-#define INST_LAHF_INDEX 1563
-#define INST_LEA_INDEX 1568
-#define INST_LEAVE_INDEX 1572
-#define INST_LFENCE_INDEX 1578
-#define INST_MASKMOVDQU_INDEX 1585
-#define INST_MASKMOVQ_INDEX 1596
-#define INST_MAXPD_INDEX 1605
-#define INST_MAXPS_INDEX 1611
-#define INST_MAXSD_INDEX 1617
-#define INST_MAXSS_INDEX 1623
-#define INST_MFENCE_INDEX 1629
-#define INST_MINPD_INDEX 1636
-#define INST_MINPS_INDEX 1642
-#define INST_MINSD_INDEX 1648
-#define INST_MINSS_INDEX 1654
-#define INST_MONITOR_INDEX 1660
-#define INST_MOV_INDEX 1668
-#define INST_MOVAPD_INDEX 1672
-#define INST_MOVAPS_INDEX 1679
-#define INST_MOVBE_INDEX 1686
-#define INST_MOVD_INDEX 1692
-#define INST_MOVDDUP_INDEX 1697
-#define INST_MOVDQ2Q_INDEX 1705
-#define INST_MOVDQA_INDEX 1713
-#define INST_MOVDQU_INDEX 1720
-#define INST_MOVHLPS_INDEX 1727
-#define INST_MOVHPD_INDEX 1735
-#define INST_MOVHPS_INDEX 1742
-#define INST_MOVLHPS_INDEX 1749
-#define INST_MOVLPD_INDEX 1757
-#define INST_MOVLPS_INDEX 1764
-#define INST_MOVMSKPD_INDEX 1771
-#define INST_MOVMSKPS_INDEX 1780
-#define INST_MOVNTDQ_INDEX 1789
-#define INST_MOVNTDQA_INDEX 1797
-#define INST_MOVNTI_INDEX 1806
-#define INST_MOVNTPD_INDEX 1813
-#define INST_MOVNTPS_INDEX 1821
-#define INST_MOVNTQ_INDEX 1829
-#define INST_MOVQ_INDEX 1836
-#define INST_MOVQ2DQ_INDEX 1841
-#define INST_MOVSD_INDEX 1849
-#define INST_MOVSHDUP_INDEX 1855
-#define INST_MOVSLDUP_INDEX 1864
-#define INST_MOVSS_INDEX 1873
-#define INST_MOVSX_INDEX 1879
-#define INST_MOVSXD_INDEX 1885
-#define INST_MOVUPD_INDEX 1892
-#define INST_MOVUPS_INDEX 1899
-#define INST_MOVZX_INDEX 1906
-#define INST_MOV_PTR_INDEX 1912
-#define INST_MPSADBW_INDEX 1920
-#define INST_MUL_INDEX 1928
-#define INST_MULPD_INDEX 1932
-#define INST_MULPS_INDEX 1938
-#define INST_MULSD_INDEX 1944
-#define INST_MULSS_INDEX 1950
-#define INST_MWAIT_INDEX 1956
-#define INST_NEG_INDEX 1962
-#define INST_NOP_INDEX 1966
-#define INST_NOT_INDEX 1970
-#define INST_OR_INDEX 1974
-#define INST_ORPD_INDEX 1977
-#define INST_ORPS_INDEX 1982
-#define INST_PABSB_INDEX 1987
-#define INST_PABSD_INDEX 1993
-#define INST_PABSW_INDEX 1999
-#define INST_PACKSSDW_INDEX 2005
-#define INST_PACKSSWB_INDEX 2014
-#define INST_PACKUSDW_INDEX 2023
-#define INST_PACKUSWB_INDEX 2032
-#define INST_PADDB_INDEX 2041
-#define INST_PADDD_INDEX 2047
-#define INST_PADDQ_INDEX 2053
-#define INST_PADDSB_INDEX 2059
-#define INST_PADDSW_INDEX 2066
-#define INST_PADDUSB_INDEX 2073
-#define INST_PADDUSW_INDEX 2081
-#define INST_PADDW_INDEX 2089
-#define INST_PALIGNR_INDEX 2095
-#define INST_PAND_INDEX 2103
-#define INST_PANDN_INDEX 2108
-#define INST_PAUSE_INDEX 2114
-#define INST_PAVGB_INDEX 2120
-#define INST_PAVGW_INDEX 2126
-#define INST_PBLENDVB_INDEX 2132
-#define INST_PBLENDW_INDEX 2141
-#define INST_PCMPEQB_INDEX 2149
-#define INST_PCMPEQD_INDEX 2157
-#define INST_PCMPEQQ_INDEX 2165
-#define INST_PCMPEQW_INDEX 2173
-#define INST_PCMPESTRI_INDEX 2181
-#define INST_PCMPESTRM_INDEX 2191
-#define INST_PCMPGTB_INDEX 2201
-#define INST_PCMPGTD_INDEX 2209
-#define INST_PCMPGTQ_INDEX 2217
-#define INST_PCMPGTW_INDEX 2225
-#define INST_PCMPISTRI_INDEX 2233
-#define INST_PCMPISTRM_INDEX 2243
-#define INST_PEXTRB_INDEX 2253
-#define INST_PEXTRD_INDEX 2260
-#define INST_PEXTRQ_INDEX 2267
-#define INST_PEXTRW_INDEX 2274
-#define INST_PF2ID_INDEX 2281
-#define INST_PF2IW_INDEX 2287
-#define INST_PFACC_INDEX 2293
-#define INST_PFADD_INDEX 2299
-#define INST_PFCMPEQ_INDEX 2305
-#define INST_PFCMPGE_INDEX 2313
-#define INST_PFCMPGT_INDEX 2321
-#define INST_PFMAX_INDEX 2329
-#define INST_PFMIN_INDEX 2335
-#define INST_PFMUL_INDEX 2341
-#define INST_PFNACC_INDEX 2347
-#define INST_PFPNACC_INDEX 2354
-#define INST_PFRCP_INDEX 2362
-#define INST_PFRCPIT1_INDEX 2368
-#define INST_PFRCPIT2_INDEX 2377
-#define INST_PFRSQIT1_INDEX 2386
-#define INST_PFRSQRT_INDEX 2395
-#define INST_PFSUB_INDEX 2403
-#define INST_PFSUBR_INDEX 2409
-#define INST_PHADDD_INDEX 2416
-#define INST_PHADDSW_INDEX 2423
-#define INST_PHADDW_INDEX 2431
-#define INST_PHMINPOSUW_INDEX 2438
-#define INST_PHSUBD_INDEX 2449
-#define INST_PHSUBSW_INDEX 2456
-#define INST_PHSUBW_INDEX 2464
-#define INST_PI2FD_INDEX 2471
-#define INST_PI2FW_INDEX 2477
-#define INST_PINSRB_INDEX 2483
-#define INST_PINSRD_INDEX 2490
-#define INST_PINSRQ_INDEX 2497
-#define INST_PINSRW_INDEX 2504
-#define INST_PMADDUBSW_INDEX 2511
-#define INST_PMADDWD_INDEX 2521
-#define INST_PMAXSB_INDEX 2529
-#define INST_PMAXSD_INDEX 2536
-#define INST_PMAXSW_INDEX 2543
-#define INST_PMAXUB_INDEX 2550
-#define INST_PMAXUD_INDEX 2557
-#define INST_PMAXUW_INDEX 2564
-#define INST_PMINSB_INDEX 2571
-#define INST_PMINSD_INDEX 2578
-#define INST_PMINSW_INDEX 2585
-#define INST_PMINUB_INDEX 2592
-#define INST_PMINUD_INDEX 2599
-#define INST_PMINUW_INDEX 2606
-#define INST_PMOVMSKB_INDEX 2613
-#define INST_PMOVSXBD_INDEX 2622
-#define INST_PMOVSXBQ_INDEX 2631
-#define INST_PMOVSXBW_INDEX 2640
-#define INST_PMOVSXDQ_INDEX 2649
-#define INST_PMOVSXWD_INDEX 2658
-#define INST_PMOVSXWQ_INDEX 2667
-#define INST_PMOVZXBD_INDEX 2676
-#define INST_PMOVZXBQ_INDEX 2685
-#define INST_PMOVZXBW_INDEX 2694
-#define INST_PMOVZXDQ_INDEX 2703
-#define INST_PMOVZXWD_INDEX 2712
-#define INST_PMOVZXWQ_INDEX 2721
-#define INST_PMULDQ_INDEX 2730
-#define INST_PMULHRSW_INDEX 2737
-#define INST_PMULHUW_INDEX 2746
-#define INST_PMULHW_INDEX 2754
-#define INST_PMULLD_INDEX 2761
-#define INST_PMULLW_INDEX 2768
-#define INST_PMULUDQ_INDEX 2775
-#define INST_POP_INDEX 2783
-#define INST_POPAD_INDEX 2787
-#define INST_POPCNT_INDEX 2793
-#define INST_POPFD_INDEX 2800
-#define INST_POPFQ_INDEX 2806
-#define INST_POR_INDEX 2812
-#define INST_PREFETCH_INDEX 2816
-#define INST_PSADBW_INDEX 2825
-#define INST_PSHUFB_INDEX 2832
-#define INST_PSHUFD_INDEX 2839
-#define INST_PSHUFW_INDEX 2846
-#define INST_PSHUFHW_INDEX 2853
-#define INST_PSHUFLW_INDEX 2861
-#define INST_PSIGNB_INDEX 2869
-#define INST_PSIGND_INDEX 2876
-#define INST_PSIGNW_INDEX 2883
-#define INST_PSLLD_INDEX 2890
-#define INST_PSLLDQ_INDEX 2896
-#define INST_PSLLQ_INDEX 2903
-#define INST_PSLLW_INDEX 2909
-#define INST_PSRAD_INDEX 2915
-#define INST_PSRAW_INDEX 2921
-#define INST_PSRLD_INDEX 2927
-#define INST_PSRLDQ_INDEX 2933
-#define INST_PSRLQ_INDEX 2940
-#define INST_PSRLW_INDEX 2946
-#define INST_PSUBB_INDEX 2952
-#define INST_PSUBD_INDEX 2958
-#define INST_PSUBQ_INDEX 2964
-#define INST_PSUBSB_INDEX 2970
-#define INST_PSUBSW_INDEX 2977
-#define INST_PSUBUSB_INDEX 2984
-#define INST_PSUBUSW_INDEX 2992
-#define INST_PSUBW_INDEX 3000
-#define INST_PSWAPD_INDEX 3006
-#define INST_PTEST_INDEX 3013
-#define INST_PUNPCKHBW_INDEX 3019
-#define INST_PUNPCKHDQ_INDEX 3029
-#define INST_PUNPCKHQDQ_INDEX 3039
-#define INST_PUNPCKHWD_INDEX 3050
-#define INST_PUNPCKLBW_INDEX 3060
-#define INST_PUNPCKLDQ_INDEX 3070
-#define INST_PUNPCKLQDQ_INDEX 3080
-#define INST_PUNPCKLWD_INDEX 3091
-#define INST_PUSH_INDEX 3101
-#define INST_PUSHAD_INDEX 3106
-#define INST_PUSHFD_INDEX 3113
-#define INST_PUSHFQ_INDEX 3120
-#define INST_PXOR_INDEX 3127
-#define INST_RCL_INDEX 3132
-#define INST_RCPPS_INDEX 3136
-#define INST_RCPSS_INDEX 3142
-#define INST_RCR_INDEX 3148
-#define INST_RDTSC_INDEX 3152
-#define INST_RDTSCP_INDEX 3158
-#define INST_REP_LODSB_INDEX 3165
-#define INST_REP_LODSD_INDEX 3175
-#define INST_REP_LODSQ_INDEX 3185
-#define INST_REP_LODSW_INDEX 3195
-#define INST_REP_MOVSB_INDEX 3205
-#define INST_REP_MOVSD_INDEX 3215
-#define INST_REP_MOVSQ_INDEX 3225
-#define INST_REP_MOVSW_INDEX 3235
-#define INST_REP_STOSB_INDEX 3245
-#define INST_REP_STOSD_INDEX 3255
-#define INST_REP_STOSQ_INDEX 3265
-#define INST_REP_STOSW_INDEX 3275
-#define INST_REPE_CMPSB_INDEX 3285
-#define INST_REPE_CMPSD_INDEX 3296
-#define INST_REPE_CMPSQ_INDEX 3307
-#define INST_REPE_CMPSW_INDEX 3318
-#define INST_REPE_SCASB_INDEX 3329
-#define INST_REPE_SCASD_INDEX 3340
-#define INST_REPE_SCASQ_INDEX 3351
-#define INST_REPE_SCASW_INDEX 3362
-#define INST_REPNE_CMPSB_INDEX 3373
-#define INST_REPNE_CMPSD_INDEX 3385
-#define INST_REPNE_CMPSQ_INDEX 3397
-#define INST_REPNE_CMPSW_INDEX 3409
-#define INST_REPNE_SCASB_INDEX 3421
-#define INST_REPNE_SCASD_INDEX 3433
-#define INST_REPNE_SCASQ_INDEX 3445
-#define INST_REPNE_SCASW_INDEX 3457
-#define INST_RET_INDEX 3469
-#define INST_ROL_INDEX 3473
-#define INST_ROR_INDEX 3477
-#define INST_ROUNDPD_INDEX 3481
-#define INST_ROUNDPS_INDEX 3489
-#define INST_ROUNDSD_INDEX 3497
-#define INST_ROUNDSS_INDEX 3505
-#define INST_RSQRTPS_INDEX 3513
-#define INST_RSQRTSS_INDEX 3521
-#define INST_SAHF_INDEX 3529
-#define INST_SAL_INDEX 3534
-#define INST_SAR_INDEX 3538
-#define INST_SBB_INDEX 3542
-#define INST_SETA_INDEX 3546
-#define INST_SETAE_INDEX 3551
-#define INST_SETB_INDEX 3557
-#define INST_SETBE_INDEX 3562
-#define INST_SETC_INDEX 3568
-#define INST_SETE_INDEX 3573
-#define INST_SETG_INDEX 3578
-#define INST_SETGE_INDEX 3583
-#define INST_SETL_INDEX 3589
-#define INST_SETLE_INDEX 3594
-#define INST_SETNA_INDEX 3600
-#define INST_SETNAE_INDEX 3606
-#define INST_SETNB_INDEX 3613
-#define INST_SETNBE_INDEX 3619
-#define INST_SETNC_INDEX 3626
-#define INST_SETNE_INDEX 3632
-#define INST_SETNG_INDEX 3638
-#define INST_SETNGE_INDEX 3644
-#define INST_SETNL_INDEX 3651
-#define INST_SETNLE_INDEX 3657
-#define INST_SETNO_INDEX 3664
-#define INST_SETNP_INDEX 3670
-#define INST_SETNS_INDEX 3676
-#define INST_SETNZ_INDEX 3682
-#define INST_SETO_INDEX 3688
-#define INST_SETP_INDEX 3693
-#define INST_SETPE_INDEX 3698
-#define INST_SETPO_INDEX 3704
-#define INST_SETS_INDEX 3710
-#define INST_SETZ_INDEX 3715
-#define INST_SFENCE_INDEX 3720
-#define INST_SHL_INDEX 3727
-#define INST_SHLD_INDEX 3731
-#define INST_SHR_INDEX 3736
-#define INST_SHRD_INDEX 3740
-#define INST_SHUFPD_INDEX 3745
-#define INST_SHUFPS_INDEX 3752
-#define INST_SQRTPD_INDEX 3759
-#define INST_SQRTPS_INDEX 3766
-#define INST_SQRTSD_INDEX 3773
-#define INST_SQRTSS_INDEX 3780
-#define INST_STC_INDEX 3787
-#define INST_STD_INDEX 3791
-#define INST_STMXCSR_INDEX 3795
-#define INST_SUB_INDEX 3803
-#define INST_SUBPD_INDEX 3807
-#define INST_SUBPS_INDEX 3813
-#define INST_SUBSD_INDEX 3819
-#define INST_SUBSS_INDEX 3825
-#define INST_TEST_INDEX 3831
-#define INST_UCOMISD_INDEX 3836
-#define INST_UCOMISS_INDEX 3844
-#define INST_UD2_INDEX 3852
-#define INST_UNPCKHPD_INDEX 3856
-#define INST_UNPCKHPS_INDEX 3865
-#define INST_UNPCKLPD_INDEX 3874
-#define INST_UNPCKLPS_INDEX 3883
-#define INST_XADD_INDEX 3892
-#define INST_XCHG_INDEX 3897
-#define INST_XOR_INDEX 3902
-#define INST_XORPD_INDEX 3906
-#define INST_XORPS_INDEX 3912
+#define INST_CLFLUSHOPT_INDEX 200
+#define INST_CLWB_INDEX 211
+#define INST_CMC_INDEX 216
+#define INST_CMOVA_INDEX 220
+#define INST_CMOVAE_INDEX 226
+#define INST_CMOVB_INDEX 233
+#define INST_CMOVBE_INDEX 239
+#define INST_CMOVC_INDEX 246
+#define INST_CMOVE_INDEX 252
+#define INST_CMOVG_INDEX 258
+#define INST_CMOVGE_INDEX 264
+#define INST_CMOVL_INDEX 271
+#define INST_CMOVLE_INDEX 277
+#define INST_CMOVNA_INDEX 284
+#define INST_CMOVNAE_INDEX 291
+#define INST_CMOVNB_INDEX 299
+#define INST_CMOVNBE_INDEX 306
+#define INST_CMOVNC_INDEX 314
+#define INST_CMOVNE_INDEX 321
+#define INST_CMOVNG_INDEX 328
+#define INST_CMOVNGE_INDEX 335
+#define INST_CMOVNL_INDEX 343
+#define INST_CMOVNLE_INDEX 350
+#define INST_CMOVNO_INDEX 358
+#define INST_CMOVNP_INDEX 365
+#define INST_CMOVNS_INDEX 372
+#define INST_CMOVNZ_INDEX 379
+#define INST_CMOVO_INDEX 386
+#define INST_CMOVP_INDEX 392
+#define INST_CMOVPE_INDEX 398
+#define INST_CMOVPO_INDEX 405
+#define INST_CMOVS_INDEX 412
+#define INST_CMOVZ_INDEX 418
+#define INST_CMP_INDEX 424
+#define INST_CMPPD_INDEX 428
+#define INST_CMPPS_INDEX 434
+#define INST_CMPSD_INDEX 440
+#define INST_CMPSS_INDEX 446
+#define INST_CMPXCHG_INDEX 452
+#define INST_CMPXCHG16B_INDEX 460
+#define INST_CMPXCHG8B_INDEX 471
+#define INST_COMISD_INDEX 481
+#define INST_COMISS_INDEX 488
+#define INST_CPUID_INDEX 495
+#define INST_CRC32_INDEX 501
+#define INST_CVTDQ2PD_INDEX 507
+#define INST_CVTDQ2PS_INDEX 516
+#define INST_CVTPD2DQ_INDEX 525
+#define INST_CVTPD2PI_INDEX 534
+#define INST_CVTPD2PS_INDEX 543
+#define INST_CVTPI2PD_INDEX 552
+#define INST_CVTPI2PS_INDEX 561
+#define INST_CVTPS2DQ_INDEX 570
+#define INST_CVTPS2PD_INDEX 579
+#define INST_CVTPS2PI_INDEX 588
+#define INST_CVTSD2SI_INDEX 597
+#define INST_CVTSD2SS_INDEX 606
+#define INST_CVTSI2SD_INDEX 615
+#define INST_CVTSI2SS_INDEX 624
+#define INST_CVTSS2SD_INDEX 633
+#define INST_CVTSS2SI_INDEX 642
+#define INST_CVTTPD2DQ_INDEX 651
+#define INST_CVTTPD2PI_INDEX 661
+#define INST_CVTTPS2DQ_INDEX 671
+#define INST_CVTTPS2PI_INDEX 681
+#define INST_CVTTSD2SI_INDEX 691
+#define INST_CVTTSS2SI_INDEX 701
+#define INST_CWDE_INDEX 711
+#define INST_DAA_INDEX 716
+#define INST_DAS_INDEX 720
+#define INST_DEC_INDEX 724
+#define INST_DIV_INDEX 728
+#define INST_DIVPD_INDEX 732
+#define INST_DIVPS_INDEX 738
+#define INST_DIVSD_INDEX 744
+#define INST_DIVSS_INDEX 750
+#define INST_DPPD_INDEX 756
+#define INST_DPPS_INDEX 761
+#define INST_EMMS_INDEX 766
+#define INST_ENTER_INDEX 771
+#define INST_EXTRACTPS_INDEX 777
+#define INST_F2XM1_INDEX 787
+#define INST_FABS_INDEX 793
+#define INST_FADD_INDEX 798
+#define INST_FADDP_INDEX 803
+#define INST_FBLD_INDEX 809
+#define INST_FBSTP_INDEX 814
+#define INST_FCHS_INDEX 820
+#define INST_FCLEX_INDEX 825
+#define INST_FCMOVB_INDEX 831
+#define INST_FCMOVBE_INDEX 838
+#define INST_FCMOVE_INDEX 846
+#define INST_FCMOVNB_INDEX 853
+#define INST_FCMOVNBE_INDEX 861
+#define INST_FCMOVNE_INDEX 870
+#define INST_FCMOVNU_INDEX 878
+#define INST_FCMOVU_INDEX 886
+#define INST_FCOM_INDEX 893
+#define INST_FCOMI_INDEX 898
+#define INST_FCOMIP_INDEX 904
+#define INST_FCOMP_INDEX 911
+#define INST_FCOMPP_INDEX 917
+#define INST_FCOS_INDEX 924
+#define INST_FDECSTP_INDEX 929
+#define INST_FDIV_INDEX 937
+#define INST_FDIVP_INDEX 942
+#define INST_FDIVR_INDEX 948
+#define INST_FDIVRP_INDEX 954
+#define INST_FEMMS_INDEX 961
+#define INST_FFREE_INDEX 967
+#define INST_FIADD_INDEX 973
+#define INST_FICOM_INDEX 979
+#define INST_FICOMP_INDEX 985
+#define INST_FIDIV_INDEX 992
+#define INST_FIDIVR_INDEX 998
+#define INST_FILD_INDEX 1005
+#define INST_FIMUL_INDEX 1010
+#define INST_FINCSTP_INDEX 1016
+#define INST_FINIT_INDEX 1024
+#define INST_FIST_INDEX 1030
+#define INST_FISTP_INDEX 1035
+#define INST_FISTTP_INDEX 1041
+#define INST_FISUB_INDEX 1048
+#define INST_FISUBR_INDEX 1054
+#define INST_FLD_INDEX 1061
+#define INST_FLD1_INDEX 1065
+#define INST_FLDCW_INDEX 1070
+#define INST_FLDENV_INDEX 1076
+#define INST_FLDL2E_INDEX 1083
+#define INST_FLDL2T_INDEX 1090
+#define INST_FLDLG2_INDEX 1097
+#define INST_FLDLN2_INDEX 1104
+#define INST_FLDPI_INDEX 1111
+#define INST_FLDZ_INDEX 1117
+#define INST_FMUL_INDEX 1122
+#define INST_FMULP_INDEX 1127
+#define INST_FNCLEX_INDEX 1133
+#define INST_FNINIT_INDEX 1140
+#define INST_FNOP_INDEX 1147
+#define INST_FNSAVE_INDEX 1152
+#define INST_FNSTCW_INDEX 1159
+#define INST_FNSTENV_INDEX 1166
+#define INST_FNSTSW_INDEX 1174
+#define INST_FPATAN_INDEX 1181
+#define INST_FPREM_INDEX 1188
+#define INST_FPREM1_INDEX 1194
+#define INST_FPTAN_INDEX 1201
+#define INST_FRNDINT_INDEX 1207
+#define INST_FRSTOR_INDEX 1215
+#define INST_FSAVE_INDEX 1222
+#define INST_FSCALE_INDEX 1228
+#define INST_FSIN_INDEX 1235
+#define INST_FSINCOS_INDEX 1240
+#define INST_FSQRT_INDEX 1248
+#define INST_FST_INDEX 1254
+#define INST_FSTCW_INDEX 1258
+#define INST_FSTENV_INDEX 1264
+#define INST_FSTP_INDEX 1271
+#define INST_FSTSW_INDEX 1276
+#define INST_FSUB_INDEX 1282
+#define INST_FSUBP_INDEX 1287
+#define INST_FSUBR_INDEX 1293
+#define INST_FSUBRP_INDEX 1299
+#define INST_FTST_INDEX 1306
+#define INST_FUCOM_INDEX 1311
+#define INST_FUCOMI_INDEX 1317
+#define INST_FUCOMIP_INDEX 1324
+#define INST_FUCOMP_INDEX 1332
+#define INST_FUCOMPP_INDEX 1339
+#define INST_FWAIT_INDEX 1347
+#define INST_FXAM_INDEX 1353
+#define INST_FXCH_INDEX 1358
+#define INST_FXRSTOR_INDEX 1363
+#define INST_FXSAVE_INDEX 1371
+#define INST_FXTRACT_INDEX 1378
+#define INST_FYL2X_INDEX 1386
+#define INST_FYL2XP1_INDEX 1392
+#define INST_HADDPD_INDEX 1400
+#define INST_HADDPS_INDEX 1407
+#define INST_HSUBPD_INDEX 1414
+#define INST_HSUBPS_INDEX 1421
+#define INST_IDIV_INDEX 1428
+#define INST_IMUL_INDEX 1433
+#define INST_INC_INDEX 1438
+#define INST_INT3_INDEX 1442
+#define INST_JA_INDEX 1447
+#define INST_JAE_INDEX 1450
+#define INST_JB_INDEX 1454
+#define INST_JBE_INDEX 1457
+#define INST_JC_INDEX 1461
+#define INST_JE_INDEX 1464
+#define INST_JG_INDEX 1467
+#define INST_JGE_INDEX 1470
+#define INST_JL_INDEX 1474
+#define INST_JLE_INDEX 1477
+#define INST_JNA_INDEX 1481
+#define INST_JNAE_INDEX 1485
+#define INST_JNB_INDEX 1490
+#define INST_JNBE_INDEX 1494
+#define INST_JNC_INDEX 1499
+#define INST_JNE_INDEX 1503
+#define INST_JNG_INDEX 1507
+#define INST_JNGE_INDEX 1511
+#define INST_JNL_INDEX 1516
+#define INST_JNLE_INDEX 1520
+#define INST_JNO_INDEX 1525
+#define INST_JNP_INDEX 1529
+#define INST_JNS_INDEX 1533
+#define INST_JNZ_INDEX 1537
+#define INST_JO_INDEX 1541
+#define INST_JP_INDEX 1544
+#define INST_JPE_INDEX 1547
+#define INST_JPO_INDEX 1551
+#define INST_JS_INDEX 1555
+#define INST_JZ_INDEX 1558
+#define INST_JMP_INDEX 1561
+#define INST_LDDQU_INDEX 1565
+#define INST_LDMXCSR_INDEX 1571
+#define INST_LAHF_INDEX 1579
+#define INST_LEA_INDEX 1584
+#define INST_LEAVE_INDEX 1588
+#define INST_LFENCE_INDEX 1594
+#define INST_MASKMOVDQU_INDEX 1601
+#define INST_MASKMOVQ_INDEX 1612
+#define INST_MAXPD_INDEX 1621
+#define INST_MAXPS_INDEX 1627
+#define INST_MAXSD_INDEX 1633
+#define INST_MAXSS_INDEX 1639
+#define INST_MFENCE_INDEX 1645
+#define INST_MINPD_INDEX 1652
+#define INST_MINPS_INDEX 1658
+#define INST_MINSD_INDEX 1664
+#define INST_MINSS_INDEX 1670
+#define INST_MONITOR_INDEX 1676
+#define INST_MOV_INDEX 1684
+#define INST_MOVAPD_INDEX 1688
+#define INST_MOVAPS_INDEX 1695
+#define INST_MOVBE_INDEX 1702
+#define INST_MOVD_INDEX 1708
+#define INST_MOVDDUP_INDEX 1713
+#define INST_MOVDQ2Q_INDEX 1721
+#define INST_MOVDQA_INDEX 1729
+#define INST_MOVDQU_INDEX 1736
+#define INST_MOVHLPS_INDEX 1743
+#define INST_MOVHPD_INDEX 1751
+#define INST_MOVHPS_INDEX 1758
+#define INST_MOVLHPS_INDEX 1765
+#define INST_MOVLPD_INDEX 1773
+#define INST_MOVLPS_INDEX 1780
+#define INST_MOVMSKPD_INDEX 1787
+#define INST_MOVMSKPS_INDEX 1796
+#define INST_MOVNTDQ_INDEX 1805
+#define INST_MOVNTDQA_INDEX 1813
+#define INST_MOVNTI_INDEX 1822
+#define INST_MOVNTPD_INDEX 1829
+#define INST_MOVNTPS_INDEX 1837
+#define INST_MOVNTQ_INDEX 1845
+#define INST_MOVQ_INDEX 1852
+#define INST_MOVQ2DQ_INDEX 1857
+#define INST_MOVSD_INDEX 1865
+#define INST_MOVSHDUP_INDEX 1871
+#define INST_MOVSLDUP_INDEX 1880
+#define INST_MOVSS_INDEX 1889
+#define INST_MOVSX_INDEX 1895
+#define INST_MOVSXD_INDEX 1901
+#define INST_MOVUPD_INDEX 1908
+#define INST_MOVUPS_INDEX 1915
+#define INST_MOVZX_INDEX 1922
+#define INST_MOV_PTR_INDEX 1928
+#define INST_MPSADBW_INDEX 1936
+#define INST_MUL_INDEX 1944
+#define INST_MULPD_INDEX 1948
+#define INST_MULPS_INDEX 1954
+#define INST_MULSD_INDEX 1960
+#define INST_MULSS_INDEX 1966
+#define INST_MWAIT_INDEX 1972
+#define INST_NEG_INDEX 1978
+#define INST_NOP_INDEX 1982
+#define INST_NOT_INDEX 1986
+#define INST_OR_INDEX 1990
+#define INST_ORPD_INDEX 1993
+#define INST_ORPS_INDEX 1998
+#define INST_PABSB_INDEX 2003
+#define INST_PABSD_INDEX 2009
+#define INST_PABSW_INDEX 2015
+#define INST_PACKSSDW_INDEX 2021
+#define INST_PACKSSWB_INDEX 2030
+#define INST_PACKUSDW_INDEX 2039
+#define INST_PACKUSWB_INDEX 2048
+#define INST_PADDB_INDEX 2057
+#define INST_PADDD_INDEX 2063
+#define INST_PADDQ_INDEX 2069
+#define INST_PADDSB_INDEX 2075
+#define INST_PADDSW_INDEX 2082
+#define INST_PADDUSB_INDEX 2089
+#define INST_PADDUSW_INDEX 2097
+#define INST_PADDW_INDEX 2105
+#define INST_PALIGNR_INDEX 2111
+#define INST_PAND_INDEX 2119
+#define INST_PANDN_INDEX 2124
+#define INST_PAUSE_INDEX 2130
+#define INST_PAVGB_INDEX 2136
+#define INST_PAVGW_INDEX 2142
+#define INST_PBLENDVB_INDEX 2148
+#define INST_PBLENDW_INDEX 2157
+#define INST_PCMPEQB_INDEX 2165
+#define INST_PCMPEQD_INDEX 2173
+#define INST_PCMPEQQ_INDEX 2181
+#define INST_PCMPEQW_INDEX 2189
+#define INST_PCMPESTRI_INDEX 2197
+#define INST_PCMPESTRM_INDEX 2207
+#define INST_PCMPGTB_INDEX 2217
+#define INST_PCMPGTD_INDEX 2225
+#define INST_PCMPGTQ_INDEX 2233
+#define INST_PCMPGTW_INDEX 2241
+#define INST_PCMPISTRI_INDEX 2249
+#define INST_PCMPISTRM_INDEX 2259
+#define INST_PEXTRB_INDEX 2269
+#define INST_PEXTRD_INDEX 2276
+#define INST_PEXTRQ_INDEX 2283
+#define INST_PEXTRW_INDEX 2290
+#define INST_PF2ID_INDEX 2297
+#define INST_PF2IW_INDEX 2303
+#define INST_PFACC_INDEX 2309
+#define INST_PFADD_INDEX 2315
+#define INST_PFCMPEQ_INDEX 2321
+#define INST_PFCMPGE_INDEX 2329
+#define INST_PFCMPGT_INDEX 2337
+#define INST_PFMAX_INDEX 2345
+#define INST_PFMIN_INDEX 2351
+#define INST_PFMUL_INDEX 2357
+#define INST_PFNACC_INDEX 2363
+#define INST_PFPNACC_INDEX 2370
+#define INST_PFRCP_INDEX 2378
+#define INST_PFRCPIT1_INDEX 2384
+#define INST_PFRCPIT2_INDEX 2393
+#define INST_PFRSQIT1_INDEX 2402
+#define INST_PFRSQRT_INDEX 2411
+#define INST_PFSUB_INDEX 2419
+#define INST_PFSUBR_INDEX 2425
+#define INST_PHADDD_INDEX 2432
+#define INST_PHADDSW_INDEX 2439
+#define INST_PHADDW_INDEX 2447
+#define INST_PHMINPOSUW_INDEX 2454
+#define INST_PHSUBD_INDEX 2465
+#define INST_PHSUBSW_INDEX 2472
+#define INST_PHSUBW_INDEX 2480
+#define INST_PI2FD_INDEX 2487
+#define INST_PI2FW_INDEX 2493
+#define INST_PINSRB_INDEX 2499
+#define INST_PINSRD_INDEX 2506
+#define INST_PINSRQ_INDEX 2513
+#define INST_PINSRW_INDEX 2520
+#define INST_PMADDUBSW_INDEX 2527
+#define INST_PMADDWD_INDEX 2537
+#define INST_PMAXSB_INDEX 2545
+#define INST_PMAXSD_INDEX 2552
+#define INST_PMAXSW_INDEX 2559
+#define INST_PMAXUB_INDEX 2566
+#define INST_PMAXUD_INDEX 2573
+#define INST_PMAXUW_INDEX 2580
+#define INST_PMINSB_INDEX 2587
+#define INST_PMINSD_INDEX 2594
+#define INST_PMINSW_INDEX 2601
+#define INST_PMINUB_INDEX 2608
+#define INST_PMINUD_INDEX 2615
+#define INST_PMINUW_INDEX 2622
+#define INST_PMOVMSKB_INDEX 2629
+#define INST_PMOVSXBD_INDEX 2638
+#define INST_PMOVSXBQ_INDEX 2647
+#define INST_PMOVSXBW_INDEX 2656
+#define INST_PMOVSXDQ_INDEX 2665
+#define INST_PMOVSXWD_INDEX 2674
+#define INST_PMOVSXWQ_INDEX 2683
+#define INST_PMOVZXBD_INDEX 2692
+#define INST_PMOVZXBQ_INDEX 2701
+#define INST_PMOVZXBW_INDEX 2710
+#define INST_PMOVZXDQ_INDEX 2719
+#define INST_PMOVZXWD_INDEX 2728
+#define INST_PMOVZXWQ_INDEX 2737
+#define INST_PMULDQ_INDEX 2746
+#define INST_PMULHRSW_INDEX 2753
+#define INST_PMULHUW_INDEX 2762
+#define INST_PMULHW_INDEX 2770
+#define INST_PMULLD_INDEX 2777
+#define INST_PMULLW_INDEX 2784
+#define INST_PMULUDQ_INDEX 2791
+#define INST_POP_INDEX 2799
+#define INST_POPAD_INDEX 2803
+#define INST_POPCNT_INDEX 2809
+#define INST_POPFD_INDEX 2816
+#define INST_POPFQ_INDEX 2822
+#define INST_POR_INDEX 2828
+#define INST_PREFETCH_INDEX 2832
+#define INST_PSADBW_INDEX 2841
+#define INST_PSHUFB_INDEX 2848
+#define INST_PSHUFD_INDEX 2855
+#define INST_PSHUFW_INDEX 2862
+#define INST_PSHUFHW_INDEX 2869
+#define INST_PSHUFLW_INDEX 2877
+#define INST_PSIGNB_INDEX 2885
+#define INST_PSIGND_INDEX 2892
+#define INST_PSIGNW_INDEX 2899
+#define INST_PSLLD_INDEX 2906
+#define INST_PSLLDQ_INDEX 2912
+#define INST_PSLLQ_INDEX 2919
+#define INST_PSLLW_INDEX 2925
+#define INST_PSRAD_INDEX 2931
+#define INST_PSRAW_INDEX 2937
+#define INST_PSRLD_INDEX 2943
+#define INST_PSRLDQ_INDEX 2949
+#define INST_PSRLQ_INDEX 2956
+#define INST_PSRLW_INDEX 2962
+#define INST_PSUBB_INDEX 2968
+#define INST_PSUBD_INDEX 2974
+#define INST_PSUBQ_INDEX 2980
+#define INST_PSUBSB_INDEX 2986
+#define INST_PSUBSW_INDEX 2993
+#define INST_PSUBUSB_INDEX 3000
+#define INST_PSUBUSW_INDEX 3008
+#define INST_PSUBW_INDEX 3016
+#define INST_PSWAPD_INDEX 3022
+#define INST_PTEST_INDEX 3029
+#define INST_PUNPCKHBW_INDEX 3035
+#define INST_PUNPCKHDQ_INDEX 3045
+#define INST_PUNPCKHQDQ_INDEX 3055
+#define INST_PUNPCKHWD_INDEX 3066
+#define INST_PUNPCKLBW_INDEX 3076
+#define INST_PUNPCKLDQ_INDEX 3086
+#define INST_PUNPCKLQDQ_INDEX 3096
+#define INST_PUNPCKLWD_INDEX 3107
+#define INST_PUSH_INDEX 3117
+#define INST_PUSHAD_INDEX 3122
+#define INST_PUSHFD_INDEX 3129
+#define INST_PUSHFQ_INDEX 3136
+#define INST_PXOR_INDEX 3143
+#define INST_RCL_INDEX 3148
+#define INST_RCPPS_INDEX 3152
+#define INST_RCPSS_INDEX 3158
+#define INST_RCR_INDEX 3164
+#define INST_RDTSC_INDEX 3168
+#define INST_RDTSCP_INDEX 3174
+#define INST_REP_LODSB_INDEX 3181
+#define INST_REP_LODSD_INDEX 3191
+#define INST_REP_LODSQ_INDEX 3201
+#define INST_REP_LODSW_INDEX 3211
+#define INST_REP_MOVSB_INDEX 3221
+#define INST_REP_MOVSD_INDEX 3231
+#define INST_REP_MOVSQ_INDEX 3241
+#define INST_REP_MOVSW_INDEX 3251
+#define INST_REP_STOSB_INDEX 3261
+#define INST_REP_STOSD_INDEX 3271
+#define INST_REP_STOSQ_INDEX 3281
+#define INST_REP_STOSW_INDEX 3291
+#define INST_REPE_CMPSB_INDEX 3301
+#define INST_REPE_CMPSD_INDEX 3312
+#define INST_REPE_CMPSQ_INDEX 3323
+#define INST_REPE_CMPSW_INDEX 3334
+#define INST_REPE_SCASB_INDEX 3345
+#define INST_REPE_SCASD_INDEX 3356
+#define INST_REPE_SCASQ_INDEX 3367
+#define INST_REPE_SCASW_INDEX 3378
+#define INST_REPNE_CMPSB_INDEX 3389
+#define INST_REPNE_CMPSD_INDEX 3401
+#define INST_REPNE_CMPSQ_INDEX 3413
+#define INST_REPNE_CMPSW_INDEX 3425
+#define INST_REPNE_SCASB_INDEX 3437
+#define INST_REPNE_SCASD_INDEX 3449
+#define INST_REPNE_SCASQ_INDEX 3461
+#define INST_REPNE_SCASW_INDEX 3473
+#define INST_RET_INDEX 3485
+#define INST_ROL_INDEX 3489
+#define INST_ROR_INDEX 3493
+#define INST_ROUNDPD_INDEX 3497
+#define INST_ROUNDPS_INDEX 3505
+#define INST_ROUNDSD_INDEX 3513
+#define INST_ROUNDSS_INDEX 3521
+#define INST_RSQRTPS_INDEX 3529
+#define INST_RSQRTSS_INDEX 3537
+#define INST_SAHF_INDEX 3545
+#define INST_SAL_INDEX 3550
+#define INST_SAR_INDEX 3554
+#define INST_SBB_INDEX 3558
+#define INST_SETA_INDEX 3562
+#define INST_SETAE_INDEX 3567
+#define INST_SETB_INDEX 3573
+#define INST_SETBE_INDEX 3578
+#define INST_SETC_INDEX 3584
+#define INST_SETE_INDEX 3589
+#define INST_SETG_INDEX 3594
+#define INST_SETGE_INDEX 3599
+#define INST_SETL_INDEX 3605
+#define INST_SETLE_INDEX 3610
+#define INST_SETNA_INDEX 3616
+#define INST_SETNAE_INDEX 3622
+#define INST_SETNB_INDEX 3629
+#define INST_SETNBE_INDEX 3635
+#define INST_SETNC_INDEX 3642
+#define INST_SETNE_INDEX 3648
+#define INST_SETNG_INDEX 3654
+#define INST_SETNGE_INDEX 3660
+#define INST_SETNL_INDEX 3667
+#define INST_SETNLE_INDEX 3673
+#define INST_SETNO_INDEX 3680
+#define INST_SETNP_INDEX 3686
+#define INST_SETNS_INDEX 3692
+#define INST_SETNZ_INDEX 3698
+#define INST_SETO_INDEX 3704
+#define INST_SETP_INDEX 3709
+#define INST_SETPE_INDEX 3714
+#define INST_SETPO_INDEX 3720
+#define INST_SETS_INDEX 3726
+#define INST_SETZ_INDEX 3731
+#define INST_SFENCE_INDEX 3736
+#define INST_SHL_INDEX 3743
+#define INST_SHLD_INDEX 3747
+#define INST_SHR_INDEX 3752
+#define INST_SHRD_INDEX 3756
+#define INST_SHUFPD_INDEX 3761
+#define INST_SHUFPS_INDEX 3768
+#define INST_SQRTPD_INDEX 3775
+#define INST_SQRTPS_INDEX 3782
+#define INST_SQRTSD_INDEX 3789
+#define INST_SQRTSS_INDEX 3796
+#define INST_STC_INDEX 3803
+#define INST_STD_INDEX 3807
+#define INST_STMXCSR_INDEX 3811
+#define INST_SUB_INDEX 3819
+#define INST_SUBPD_INDEX 3823
+#define INST_SUBPS_INDEX 3829
+#define INST_SUBSD_INDEX 3835
+#define INST_SUBSS_INDEX 3841
+#define INST_TEST_INDEX 3847
+#define INST_UCOMISD_INDEX 3852
+#define INST_UCOMISS_INDEX 3860
+#define INST_UD2_INDEX 3868
+#define INST_UNPCKHPD_INDEX 3872
+#define INST_UNPCKHPS_INDEX 3881
+#define INST_UNPCKLPD_INDEX 3890
+#define INST_UNPCKLPS_INDEX 3899
+#define INST_XADD_INDEX 3908
+#define INST_XCHG_INDEX 3913
+#define INST_XOR_INDEX 3918
+#define INST_XORPD_INDEX 3922
+#define INST_XORPS_INDEX 3928
 // ${INSTRUCTION_DATA_END}
 
 // ============================================================================
@@ -1303,6 +1307,8 @@ const InstructionDescription instructionDescription[] =
   MAKE_INST(INST_CLC              , "clc"              , G(EMIT)          , F(NONE)          , 0                   , 0                   , 0, 0x000000F8, 0),
   MAKE_INST(INST_CLD              , "cld"              , G(EMIT)          , F(NONE)          , 0                   , 0                   , 0, 0x000000FC, 0),
   MAKE_INST(INST_CLFLUSH          , "clflush"          , G(M)             , F(NONE)          , O(MEM)              , 0                   , 7, 0x00000FAE, 0),
+  MAKE_INST(INST_CLFLUSHOPT       , "clflushopt"       , G(M)             , F(NONE)          , O(MEM)              , 0                   , 7, 0x66000FAE, 0),
+  MAKE_INST(INST_CLWB             , "clwb"             , G(M)             , F(NONE)          , O(MEM)              , 0                   , 6, 0x66000FAE, 0),
   MAKE_INST(INST_CMC              , "cmc"              , G(EMIT)          , F(NONE)          , 0                   , 0                   , 0, 0x000000F5, 0),
   MAKE_INST(INST_CMOVA            , "cmova"            , G(R_RM)          , F(NONE)          , O(GQDW)             , O(GQDW_MEM)         , 0, 0x00000F47, 0),
   MAKE_INST(INST_CMOVAE           , "cmovae"           , G(R_RM)          , F(NONE)          , O(GQDW)             , O(GQDW_MEM)         , 0, 0x00000F43, 0),
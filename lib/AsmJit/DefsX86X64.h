@@ -749,6 +749,8 @@ enum INST_CODE
   INST_CLC,           // X86/X64
   INST_CLD,           // X86/X64
   INST_CLFLUSH,
+  INST_CLFLUSHOPT,    // X86/X64 (CLFLUSHOPT)
+  INST_CLWB,          // X86/X64 (CLWB)
   INST_CMC,           // X86/X64
 
   INST_CMOV,          // Begin (cmovcc) (i586)
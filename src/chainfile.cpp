@@ -0,0 +1,140 @@
+/*******************************************************************************
+ * Copyright (c) 2006 International Business Machines Corporation.             *
+ * All rights reserved. This program and the accompanying materials            *
+ * are made available under the terms of the Common Public License v1.0        *
+ * which accompanies this distribution, and is available at                    *
+ * http://www.opensource.org/licenses/cpl1.0.php                               *
+ *                                                                             *
+ * Contributors:                                                               *
+ *    Douglas M. Pase - initial API and implementation                         *
+ *    Tim Besard - prefetching, JIT compilation                                *
+ *******************************************************************************/
+
+//
+// Configuration
+//
+
+// Implementation header
+#include "chainfile.h"
+
+// System includes
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+
+//
+// Implementation
+//
+
+static const char magic[8] = { 'p', 'C', 'h', 'a', 's', 'e', 0, 0 };
+
+ChainFile::ChainFile() :
+		base(NULL), size(0), lengths(NULL) {
+}
+
+ChainFile::~ChainFile() {
+	if (this->base != NULL)
+		munmap(this->base, this->size);
+}
+
+// map a chain file, failing if it is not a
+// chain file or its contents are truncated
+bool ChainFile::open(const char* file) {
+	int fd = ::open(file, O_RDONLY);
+	if (fd < 0)
+		return false;
+
+	struct stat st;
+	if (fstat(fd, &st) != 0 || (size_t) st.st_size < sizeof(Header)) {
+		close(fd);
+		return false;
+	}
+
+	this->size = st.st_size;
+	this->base = mmap(NULL, this->size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (this->base == MAP_FAILED) {
+		this->base = NULL;
+		return false;
+	}
+
+	const Header& h = this->header();
+	if (memcmp(h.magic, magic, sizeof(magic)) != 0 || h.version != VERSION
+			|| (h.link_size != 4 && h.link_size != 8)
+			|| h.threads <= 0 || h.chains_per_thread <= 0) {
+		return false;
+	}
+
+	// locate the links of every chain
+	size_t offset = sizeof(Header) + this->chains() * sizeof(int64);
+	if (this->size < offset)
+		return false;
+	this->lengths = (const int64*) ((const char*) this->base + sizeof(Header));
+	for (int64 i = 0; i < this->chains(); i++) {
+		if (this->lengths[i] <= 0)
+			return false;
+		this->start.push_back((const char*) this->base + offset);
+		offset += this->lengths[i] * h.link_size;
+		if (this->size < offset)
+			return false;
+	}
+
+	return true;
+}
+
+const ChainFile::Header& ChainFile::header() const {
+	return *(const Header*) this->base;
+}
+
+int64 ChainFile::chains() const {
+	return this->header().threads * this->header().chains_per_thread;
+}
+
+int64 ChainFile::length(int64 chain) const {
+	return this->lengths[chain];
+}
+
+int64 ChainFile::link(int64 chain, int64 position) const {
+	if (this->header().link_size == 4)
+		return ((const uint32*) this->start[chain])[position];
+	return ((const int64*) this->start[chain])[position];
+}
+
+void ChainFile::init(Header& header) {
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, magic, sizeof(magic));
+	header.version = VERSION;
+}
+
+// write the chains, using 32-bit offsets
+// when every link offset fits
+bool ChainFile::save(const char* file, Header& header,
+		const std::vector<std::vector<int64> >& chains) {
+	int64 links_per_chain = header.bytes_per_chain / header.pointer_size;
+	header.link_size = links_per_chain <= 0xffffffffLL ? 4 : 8;
+
+	FILE* f = fopen(file, "wb");
+	if (f == NULL)
+		return false;
+
+	bool ok = fwrite(&header, sizeof(header), 1, f) == 1;
+	for (size_t i = 0; ok && i < chains.size(); i++) {
+		int64 length = chains[i].size();
+		ok = fwrite(&length, sizeof(length), 1, f) == 1;
+	}
+	for (size_t i = 0; ok && i < chains.size(); i++) {
+		if (header.link_size == 4) {
+			std::vector<uint32> links(chains[i].begin(), chains[i].end());
+			ok = fwrite(&links[0], sizeof(uint32), links.size(), f) == links.size();
+		} else {
+			ok = fwrite(&chains[i][0], sizeof(int64), chains[i].size(), f)
+					== chains[i].size();
+		}
+	}
+
+	return fclose(f) == 0 && ok;
+}
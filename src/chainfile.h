@@ -0,0 +1,82 @@
+/*******************************************************************************
+ * Copyright (c) 2006 International Business Machines Corporation.             *
+ * All rights reserved. This program and the accompanying materials            *
+ * are made available under the terms of the Common Public License v1.0        *
+ * which accompanies this distribution, and is available at                    *
+ * http://www.opensource.org/licenses/cpl1.0.php                               *
+ *                                                                             *
+ * Contributors:                                                               *
+ *    Douglas M. Pase - initial API and implementation                         *
+ *    Tim Besard - prefetching, JIT compilation                                *
+ *******************************************************************************/
+
+//
+// Configuration
+//
+
+// Include guard
+#if !defined(CHAINFILE_H)
+#define CHAINFILE_H
+
+// System includes
+#include <cstddef>
+#include <vector>
+
+// Local includes
+#include "types.h"
+
+
+//
+// Class definition
+//
+
+/*
+ * A chain file stores the order in which chains visit their links, as link
+ * offsets relative to the start of the chain memory, so chains can be rebuilt
+ * in memory at any address. The header records the parameters the chains
+ * were built with, followed by the length of every chain and the offsets
+ * of all chains in turn (32 bits wide when they fit, 64 bits otherwise).
+ */
+
+class ChainFile {
+public:
+	ChainFile();
+	~ChainFile();
+
+	struct Header {
+		char magic[8];				// "pChase" and two zero bytes
+		int64 version;				// version of the file format
+		int64 link_size;			// bytes per stored link offset
+		int64 pointer_size;			// the experiment parameters
+		int64 bytes_per_line;		// the chains were built with
+		int64 bytes_per_page;
+		int64 bytes_per_chain;
+		int64 threads;				// threads with chains of their own
+		int64 chains_per_thread;
+		int64 access_pattern;
+		int64 stride;
+		float64 zipf_exponent;
+		float64 hot_fraction;
+		float64 hot_share;
+	};
+
+	bool open(const char* file);
+	const Header& header() const;
+	int64 chains() const;
+	int64 length(int64 chain) const;
+	int64 link(int64 chain, int64 position) const;
+
+	static void init(Header& header);
+	static bool save(const char* file, Header& header,
+			const std::vector<std::vector<int64> >& chains);
+
+	const static int64 VERSION = 1;
+
+private:
+	void* base;					// file mapping
+	size_t size;				// bytes mapped
+	const int64* lengths;		// length of every chain
+	std::vector<const char*> start;	// links of every chain
+};
+
+#endif
@@ -22,12 +22,18 @@
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
+#include <ctype.h>
+#include <math.h>
+#include <algorithm>
 #if defined(NUMA)
 #include <numa.h>
 #endif
 
 // Local includes
+#include <AsmJit/CpuInfo.h>
 #include "chain.h"
+#include "topology.h"
+#include "pagemap.h"
 
 
 //
@@ -54,17 +60,80 @@ Experiment::Experiment() :
     seconds          (DEFAULT_SECONDS),
     iterations       (DEFAULT_ITERATIONS),
     experiments      (DEFAULT_EXPERIMENTS),
+    mlp_sweep        (0),
+    thread_sweep     (0),
+    page_sweep       (0),
+    way_sweep        (0),
+    monitor_interval (0),
+    monitor_duration (0),
+    duty_cycle       (1),
+    prometheus_file  (NULL),
     prefetch_hint    (NONE),
+    flush_scope      (NO_FLUSH),
+    flush_instruction(CLFLUSH),
+    atomic_op        (NO_ATOMIC),
+    atomic_layout    (PADDED),
+    share_threads    (0),
+    share_node       (-1),
+    share_offset     (false),
+    sibling_work     (NO_SIBLING),
     output_mode      (TABLE),
     access_pattern   (RANDOM),
     stride           (1),
+    zipf_exponent    (1),
+    zipf_share       (0),
+    hot_fraction     (0),
+    hot_share        (0),
+    trace_file       (NULL),
+    lines_per_visit  (1),
+    page_stride      (0),
+    pages_per_walk   (0),
+    conflict_level   (0),
+    conflict_stride  (0),
+    conflict_ways    (0),
+    physical_mask    (0),
+    physical_value   (0),
+    physical_select  (false),
+    physical_pages   (0),
+    dram_class       (ROW_HIT),
+    dram_sweep       (false),
+    dram_banks       (NULL),
+    dram_bank_bits   (0),
+    dram_row_mask    (0),
+    memory_backing   (ANON_BACKING),
+    backing_path     (NULL),
+    populate         (false),
+    page_faults      (NO_FAULTS),
+    fault_unbound    (false),
+    migrate_node     (-1),
+    migrate_batch    (1),
+    migrate_bulk     (false),
+    migrate_chase    (false),
+    ring_slots       (0),
+    ring_bytes       (64),
+    ring_batch       (1),
     numa_placement   (LOCAL),
     offset_or_mask   (0),
     placement_map    (NULL),
+    placement_nodes  (NULL),
+    placement_weights(NULL),
+    num_placement_nodes(0),
+    tier_node        (0),
+    tier_fraction    (0),
+    tier_hot         (true),
+    tier_share       (0),
     thread_domain    (NULL),
+    thread_cpu       (NULL),
+    listed_cpus      (NULL),
+    num_listed_cpus  (0),
     chain_domain     (NULL),
     numa_max_domain  (0),
-    num_numa_domains (1)
+    num_numa_domains (1),
+    jit_dump         (NULL),
+    save_chain       (NULL),
+    load_chain       (NULL),
+    chain_file       (NULL),
+    recalibrate      (false)
 {
 }
 
@@ -80,12 +149,63 @@ Experiment::~Experiment() {
 // -t or --threads          number of threads (concurrency and contention)
 // -i or --iters            iterations
 // -e or --experiments      experiments
+// --mlp-sweep <limit>      sweep chains per thread from 1 up to <limit>
+// --thread-sweep <limit>   sweep threads from 1 up to <limit>, or all cpus
+// --cpus <c1,c2,...>       pin threads to the listed cpus in turn
+// --page-sweep <limit>     sweep pages walked from 1 up to <limit>
+// --way-sweep <limit>      sweep aliasing lines from 1 up to <limit>
+// --monitor <seconds>      sample latency and bandwidth every interval
+// --duration <seconds>     stop monitoring after this long
+// --duty <fraction>        run for this fraction of every interval
+// --prometheus <file>      export every sample to a node_exporter textfile
 // -g or --loop				cycles to execute for each iteration (latency hiding)
 // -f or --prefetch			use of prefetching
+// --flush                  flushing of cache lines
+//         none             no flushing
+//         line <insn>      flush every line after it is visited
+//         chain <insn>     flush the whole chain between iterations
+// --atomic                 atomic read-modify-write on every visited line
+//         none             plain loads only
+//         <op> <layout>    xadd, cmpxchg or xchg on padded, shared or false-shared lines
+// --share <n>|all[:<node>][:offset]
+//                          groups of threads walking the same chains
+// --sibling                work on the smt sibling of the chasing thread
+//         compute          a dependent chain of multiplications
+//         chase            chasing chains of its own
+//         stream           reading its chain memory in order
+// --backing                memory backing the chains
+//         anon             anonymous heap memory
+//         shm              shared memory segments
+//         file:<dir>       files in <dir>, cached in the page cache
+//         dax:<dir>        files in <dir> on a dax file system
+// --populate               prefault mapped chains
+// --physical <mask>[=<val>] select or group pages by physical address bits
+// --dram-map <banks>:<row> physical address mapping of dram banks and rows
+// --page-faults            time the first touch of freshly mapped chains
+//         4k               base pages
+//         thp              transparent huge pages
+//         hugetlb          pages from the hugetlb pool
+//         <pages>:unbound  without binding the chains to their numa domains
+// --migrate <node>[:<pages>|:bulk][:chase]
+//                          time migrating the chains to a node and back
+// --ring <slots>[:<bytes>[:<batch>]]
+//                          stream messages from a producer to consumer threads
+// --dump-jit <file>        dump the generated code as a listing and raw binary
+// --save-chain <file>      save the chains after building them
+// --load-chain <file>      load the chains instead of building them
+// --recalibrate            calibrate the timer even if a calibration is cached
 // -a or --access           memory access pattern
 //         random           random access pattern
 //         forward <stride> exclusive OR and mask
 //         reverse <stride> addition and offset
+//         zipf <exponent>  lines visited with zipf distributed frequencies
+//         hotcold <fraction> <share>
+//                          a fraction of hot lines receives a share of the visits
+//         trace <file>     replay the addresses of a trace
+//         pages <lines> <order>
+//                          visit random lines of every page, pages in random or strided order
+//         conflict <stride> visit lines aliasing to one cache set, l1, l2, l3 or bytes apart
+//         dram <class>     visit lines of one dram row (hit), bank (conflict) or every bank (banks)
 // -o or --output           output mode
 //         hdr              header only
 //         csv              csv only
@@ -96,6 +216,13 @@ Experiment::~Experiment() {
 //         xor <mask>       exclusive OR and mask
 //         add <offset>     addition and offset
 //         map <map>        explicit mapping of threads and chains to domains
+//         interleave[:<nodes>]
+//                          pages of every chain interleaved over nodes (or all)
+//         weighted:<node=weight,...>
+//                          pages of every chain interleaved in proportion to weights
+//         split:<nodes>    every chain split into equal contiguous parts over nodes
+//         tier:<node>:<frac>[:hot|cold]
+//                          a fraction of the pages of every chain on a far tier node
 
 int Experiment::parse_args(int argc, char* argv[]) {
 	bool error = false;
@@ -109,6 +236,8 @@ int Experiment::parse_args(int argc, char* argv[]) {
 		} else if (strcasecmp(argv[i], "-x") == 0
 				|| strcasecmp(argv[i], "--strict") == 0) {
 			this->strict = true;
+		} else if (strcasecmp(argv[i], "--recalibrate") == 0) {
+			this->recalibrate = true;
 		} else if (strcasecmp(argv[i], "-s") == 0
 				|| strcasecmp(argv[i], "--seconds") == 0) {
 			i++;
@@ -223,6 +352,131 @@ int Experiment::parse_args(int argc, char* argv[]) {
 				error = true;
 				break;
 			}
+		} else if (strcasecmp(argv[i], "--mlp-sweep") == 0) {
+			i++;
+			if (i == argc) {
+				strncpy(errorString, "limit of chains per thread missing", errorStringSize);
+				error = true;
+				break;
+			}
+			this->mlp_sweep = Experiment::parse_number(argv[i]);
+			if (this->mlp_sweep == 0) {
+				strncpy(errorString, "invalid limit of chains per thread", errorStringSize);
+				error = true;
+				break;
+			}
+		} else if (strcasecmp(argv[i], "--page-sweep") == 0) {
+			i++;
+			if (i == argc) {
+				strncpy(errorString, "limit of pages walked missing", errorStringSize);
+				error = true;
+				break;
+			}
+			this->page_sweep = Experiment::parse_number(argv[i]);
+			if (this->page_sweep == 0) {
+				strncpy(errorString, "invalid limit of pages walked", errorStringSize);
+				error = true;
+				break;
+			}
+		} else if (strcasecmp(argv[i], "--way-sweep") == 0) {
+			i++;
+			if (i == argc) {
+				strncpy(errorString, "limit of aliasing lines missing", errorStringSize);
+				error = true;
+				break;
+			}
+			this->way_sweep = Experiment::parse_number(argv[i]);
+			if (this->way_sweep == 0) {
+				strncpy(errorString, "invalid limit of aliasing lines", errorStringSize);
+				error = true;
+				break;
+			}
+		} else if (strcasecmp(argv[i], "--thread-sweep") == 0) {
+			i++;
+			if (i == argc) {
+				strncpy(errorString, "limit of threads missing", errorStringSize);
+				error = true;
+				break;
+			}
+			if (strcasecmp(argv[i], "all") == 0) {
+				this->thread_sweep = Topology::cpus().size();
+			} else {
+				this->thread_sweep = Experiment::parse_number(argv[i]);
+			}
+			if (this->thread_sweep == 0) {
+				strncpy(errorString, "invalid limit of threads", errorStringSize);
+				error = true;
+				break;
+			}
+		} else if (strcasecmp(argv[i], "--cpus") == 0) {
+			i++;
+			if (i == argc) {
+				strncpy(errorString, "list of cpus missing", errorStringSize);
+				error = true;
+				break;
+			}
+			std::vector<int32> available = Topology::cpus();
+			std::vector<int32> listed;
+			char* end = argv[i];
+			do {
+				char* cpu = *end == ',' ? end + 1 : end;
+				listed.push_back(strtol(cpu, &end, 10));
+				if (end == cpu || std::find(available.begin(), available.end(),
+						listed.back()) == available.end()) {
+					end = cpu;
+					break;
+				}
+			} while (*end == ',');
+			if (*end != '\0') {
+				snprintf(errorString, errorStringSize, "invalid list of cpus -- '%s'", argv[i]);
+				error = true;
+				break;
+			}
+			this->num_listed_cpus = listed.size();
+			this->listed_cpus = new int32[listed.size()];
+			std::copy(listed.begin(), listed.end(), this->listed_cpus);
+		} else if (strcasecmp(argv[i], "--monitor") == 0) {
+			i++;
+			if (i == argc) {
+				strncpy(errorString, "monitor interval missing", errorStringSize);
+				error = true;
+				break;
+			}
+			this->monitor_interval = Experiment::parse_real(argv[i]);
+			if (this->monitor_interval <= 0) {
+				strncpy(errorString, "invalid monitor interval", errorStringSize);
+				error = true;
+				break;
+			}
+		} else if (strcasecmp(argv[i], "--duration") == 0) {
+			i++;
+			if (i == argc) {
+				strncpy(errorString, "monitor duration missing", errorStringSize);
+				error = true;
+				break;
+			}
+			this->monitor_duration = Experiment::parse_real(argv[i]);
+		} else if (strcasecmp(argv[i], "--duty") == 0) {
+			i++;
+			if (i == argc) {
+				strncpy(errorString, "duty cycle missing", errorStringSize);
+				error = true;
+				break;
+			}
+			this->duty_cycle = Experiment::parse_real(argv[i]);
+			if (this->duty_cycle <= 0 || 1 < this->duty_cycle) {
+				strncpy(errorString, "invalid duty cycle", errorStringSize);
+				error = true;
+				break;
+			}
+		} else if (strcasecmp(argv[i], "--prometheus") == 0) {
+			i++;
+			if (i == argc) {
+				strncpy(errorString, "prometheus file missing", errorStringSize);
+				error = true;
+				break;
+			}
+			this->prometheus_file = argv[i];
 		} else if (strcasecmp(argv[i], "-g") == 0
 				|| strcasecmp(argv[i], "--loop") == 0) {
 			i++;
@@ -260,6 +514,316 @@ int Experiment::parse_args(int argc, char* argv[]) {
 				error = true;
 				break;
 			}
+		} else if (strcasecmp(argv[i], "--flush") == 0) {
+			i++;
+			if (i == argc) {
+				strncpy(errorString, "type of flush missing", errorStringSize);
+				error = true;
+				break;
+			}
+			if (strcasecmp(argv[i], "none") == 0) {
+				this->flush_scope = NO_FLUSH;
+			} else if (strcasecmp(argv[i], "line") == 0
+					|| strcasecmp(argv[i], "chain") == 0) {
+				if (strcasecmp(argv[i], "line") == 0) {
+					this->flush_scope = LINE_FLUSH;
+				} else {
+					this->flush_scope = CHAIN_FLUSH;
+				}
+				i++;
+				if (i == argc) {
+					strncpy(errorString, "flush instruction missing", errorStringSize);
+					error = true;
+					break;
+				}
+				if (strcasecmp(argv[i], "clflush") == 0) {
+					this->flush_instruction = CLFLUSH;
+				} else if (strcasecmp(argv[i], "clflushopt") == 0) {
+					this->flush_instruction = CLFLUSHOPT;
+				} else if (strcasecmp(argv[i], "clwb") == 0) {
+					this->flush_instruction = CLWB;
+				} else {
+					snprintf(errorString, errorStringSize, "invalid flush instruction -- '%s'", argv[i]);
+					error = true;
+					break;
+				}
+			} else {
+				snprintf(errorString, errorStringSize, "invalid type of flush -- '%s'", argv[i]);
+				error = true;
+				break;
+			}
+		} else if (strcasecmp(argv[i], "--backing") == 0) {
+			i++;
+			if (i == argc) {
+				strncpy(errorString, "memory backing missing", errorStringSize);
+				error = true;
+				break;
+			}
+			if (strcasecmp(argv[i], "anon") == 0) {
+				this->memory_backing = ANON_BACKING;
+			} else if (strcasecmp(argv[i], "4k") == 0) {
+				this->memory_backing = BASE_BACKING;
+			} else if (strcasecmp(argv[i], "thp") == 0) {
+				this->memory_backing = THP_BACKING;
+			} else if (strcasecmp(argv[i], "hugetlb") == 0) {
+				this->memory_backing = HUGETLB_BACKING;
+			} else if (strcasecmp(argv[i], "shm") == 0) {
+				this->memory_backing = SHM_BACKING;
+			} else if (strncasecmp(argv[i], "file:", 5) == 0) {
+				this->memory_backing = FILE_BACKING;
+				this->backing_path = argv[i] + 5;
+			} else if (strncasecmp(argv[i], "dax:", 4) == 0) {
+				this->memory_backing = DAX_BACKING;
+				this->backing_path = argv[i] + 4;
+			} else {
+				snprintf(errorString, errorStringSize, "invalid memory backing -- '%s'", argv[i]);
+				error = true;
+				break;
+			}
+			if (this->backing_path != NULL
+					&& ::access(this->backing_path, W_OK | X_OK) != 0) {
+				snprintf(errorString, errorStringSize, "cannot create files in directory -- '%s'", this->backing_path);
+				error = true;
+				break;
+			}
+		} else if (strcasecmp(argv[i], "--physical") == 0) {
+			i++;
+			if (i == argc) {
+				strncpy(errorString, "physical address mask missing", errorStringSize);
+				error = true;
+				break;
+			}
+			char* end = NULL;
+			this->physical_mask = strtoull(argv[i], &end, 0);
+			this->physical_select = *end == '=';
+			if (this->physical_select) {
+				this->physical_value = strtoull(end + 1, &end, 0);
+			}
+			if (*end != '\0' || this->physical_mask == 0
+					|| (this->physical_mask & (sysconf(_SC_PAGESIZE) - 1)) != 0
+					|| (this->physical_value & ~this->physical_mask) != 0) {
+				snprintf(errorString, errorStringSize, "invalid physical address mask -- '%s'", argv[i]);
+				error = true;
+				break;
+			}
+		} else if (strcasecmp(argv[i], "--dram-map") == 0) {
+			i++;
+			if (i == argc) {
+				strncpy(errorString, "dram address mapping missing", errorStringSize);
+				error = true;
+				break;
+			}
+			// every bank bit is the parity of the address bits
+			// under its mask, the row is the address bits under
+			// the row mask
+			const int max_bank_bits = 16;
+			this->dram_banks = new uint64[max_bank_bits];
+			this->dram_bank_bits = 0;
+			char* end = argv[i];
+			do {
+				if (this->dram_bank_bits == max_bank_bits) {
+					break;
+				}
+				this->dram_banks[this->dram_bank_bits++] = strtoull(end, &end, 0);
+			} while (*end++ == ',');
+			if (end[-1] == ':') {
+				this->dram_row_mask = strtoull(end, &end, 0);
+			}
+			if (*end != '\0' || this->dram_row_mask == 0) {
+				snprintf(errorString, errorStringSize, "invalid dram address mapping -- '%s'", argv[i]);
+				error = true;
+				break;
+			}
+		} else if (strcasecmp(argv[i], "--populate") == 0) {
+			this->populate = true;
+		} else if (strcasecmp(argv[i], "--page-faults") == 0) {
+			i++;
+			if (i == argc) {
+				strncpy(errorString, "type of pages missing", errorStringSize);
+				error = true;
+				break;
+			}
+			const char* unbound = strchr(argv[i], ':');
+			int length = unbound == NULL ? strlen(argv[i]) : unbound - argv[i];
+			if (unbound != NULL && strcasecmp(unbound, ":unbound") != 0) {
+				snprintf(errorString, errorStringSize, "invalid type of pages -- '%s'", argv[i]);
+				error = true;
+				break;
+			}
+			this->fault_unbound = unbound != NULL;
+			if (length == 2 && strncasecmp(argv[i], "4k", length) == 0) {
+				this->page_faults = BASE_FAULTS;
+			} else if (length == 3 && strncasecmp(argv[i], "thp", length) == 0) {
+				this->page_faults = THP_FAULTS;
+			} else if (length == 7 && strncasecmp(argv[i], "hugetlb", length) == 0) {
+				this->page_faults = HUGETLB_FAULTS;
+			} else {
+				snprintf(errorString, errorStringSize, "invalid type of pages -- '%s'", argv[i]);
+				error = true;
+				break;
+			}
+		} else if (strcasecmp(argv[i], "--migrate") == 0) {
+			i++;
+			if (i == argc) {
+				strncpy(errorString, "migration missing", errorStringSize);
+				error = true;
+				break;
+			}
+			char* end = NULL;
+			this->migrate_node = strtol(argv[i], &end, 10);
+			bool valid = end != argv[i] && 0 <= this->migrate_node;
+			if (strncasecmp(end, ":bulk", 5) == 0) {
+				this->migrate_bulk = true;
+				end += 5;
+			} else if (*end == ':' && isdigit(end[1])) {
+				this->migrate_batch = strtol(end + 1, &end, 10);
+				valid = valid && 0 < this->migrate_batch;
+			}
+			if (strcasecmp(end, ":chase") == 0) {
+				this->migrate_chase = true;
+			} else if (*end != '\0') {
+				valid = false;
+			}
+			if (!valid) {
+				snprintf(errorString, errorStringSize, "invalid migration -- '%s'", argv[i]);
+				error = true;
+				break;
+			}
+		} else if (strcasecmp(argv[i], "--ring") == 0) {
+			i++;
+			if (i == argc) {
+				strncpy(errorString, "ring missing", errorStringSize);
+				error = true;
+				break;
+			}
+			char* end = NULL;
+			this->ring_slots = strtol(argv[i], &end, 10);
+			bool valid = end != argv[i] && 0 < this->ring_slots;
+			if (*end == ':') {
+				this->ring_bytes = strtol(end + 1, &end, 10);
+			}
+			if (*end == ':') {
+				this->ring_batch = strtol(end + 1, &end, 10);
+			}
+			if (!valid || *end != '\0' || this->ring_bytes < 8
+					|| (this->ring_bytes & (this->ring_bytes - 1)) != 0
+					|| this->ring_batch <= 0 || this->ring_slots < this->ring_batch) {
+				snprintf(errorString, errorStringSize, "invalid ring -- '%s'", argv[i]);
+				error = true;
+				break;
+			}
+		} else if (strcasecmp(argv[i], "--atomic") == 0) {
+			i++;
+			if (i == argc) {
+				strncpy(errorString, "type of atomic operation missing", errorStringSize);
+				error = true;
+				break;
+			}
+			if (strcasecmp(argv[i], "none") == 0) {
+				this->atomic_op = NO_ATOMIC;
+			} else if (strcasecmp(argv[i], "xadd") == 0
+					|| strcasecmp(argv[i], "cmpxchg") == 0
+					|| strcasecmp(argv[i], "xchg") == 0) {
+				if (strcasecmp(argv[i], "xadd") == 0) {
+					this->atomic_op = XADD;
+				} else if (strcasecmp(argv[i], "cmpxchg") == 0) {
+					this->atomic_op = CMPXCHG;
+				} else {
+					this->atomic_op = XCHG;
+				}
+				i++;
+				if (i == argc) {
+					strncpy(errorString, "layout of atomic operation missing", errorStringSize);
+					error = true;
+					break;
+				}
+				if (strcasecmp(argv[i], "padded") == 0) {
+					this->atomic_layout = PADDED;
+				} else if (strcasecmp(argv[i], "shared") == 0) {
+					this->atomic_layout = SHARED;
+				} else if (strcasecmp(argv[i], "false") == 0) {
+					this->atomic_layout = FALSE_SHARED;
+				} else {
+					snprintf(errorString, errorStringSize, "invalid layout of atomic operation -- '%s'", argv[i]);
+					error = true;
+					break;
+				}
+			} else {
+				snprintf(errorString, errorStringSize, "invalid type of atomic operation -- '%s'", argv[i]);
+				error = true;
+				break;
+			}
+		} else if (strcasecmp(argv[i], "--sibling") == 0) {
+			i++;
+			if (i == argc) {
+				strncpy(errorString, "work of the sibling missing", errorStringSize);
+				error = true;
+				break;
+			}
+			if (strcasecmp(argv[i], "compute") == 0) {
+				this->sibling_work = COMPUTE_SIBLING;
+			} else if (strcasecmp(argv[i], "chase") == 0) {
+				this->sibling_work = CHASE_SIBLING;
+			} else if (strcasecmp(argv[i], "stream") == 0) {
+				this->sibling_work = STREAM_SIBLING;
+			} else {
+				snprintf(errorString, errorStringSize, "invalid work of the sibling -- '%s'", argv[i]);
+				error = true;
+				break;
+			}
+		} else if (strcasecmp(argv[i], "--share") == 0) {
+			i++;
+			if (i == argc) {
+				strncpy(errorString, "sharers missing", errorStringSize);
+				error = true;
+				break;
+			}
+			char* end = argv[i];
+			bool valid = true;
+			if (strncasecmp(argv[i], "all", 3) == 0) {
+				this->share_threads = -1;
+				end += 3;
+			} else {
+				this->share_threads = strtol(argv[i], &end, 10);
+				valid = end != argv[i] && 0 < this->share_threads;
+			}
+			if (*end == ':' && isdigit(end[1])) {
+				this->share_node = strtol(end + 1, &end, 10);
+			}
+			if (strcasecmp(end, ":offset") == 0) {
+				this->share_offset = true;
+			} else if (*end != '\0') {
+				valid = false;
+			}
+			if (!valid) {
+				snprintf(errorString, errorStringSize, "invalid sharers -- '%s'", argv[i]);
+				error = true;
+				break;
+			}
+		} else if (strcasecmp(argv[i], "--dump-jit") == 0) {
+			i++;
+			if (i == argc) {
+				strncpy(errorString, "jit dump file missing", errorStringSize);
+				error = true;
+				break;
+			}
+			this->jit_dump = argv[i];
+		} else if (strcasecmp(argv[i], "--save-chain") == 0) {
+			i++;
+			if (i == argc) {
+				strncpy(errorString, "chain file to save missing", errorStringSize);
+				error = true;
+				break;
+			}
+			this->save_chain = argv[i];
+		} else if (strcasecmp(argv[i], "--load-chain") == 0) {
+			i++;
+			if (i == argc) {
+				strncpy(errorString, "chain file to load missing", errorStringSize);
+				error = true;
+				break;
+			}
+			this->load_chain = argv[i];
 		} else if (strcasecmp(argv[i], "-a") == 0
 				|| strcasecmp(argv[i], "--access") == 0) {
 			i++;
@@ -298,6 +862,128 @@ int Experiment::parse_args(int argc, char* argv[]) {
 					error = true;
 					break;
 				}
+			} else if (strcasecmp(argv[i], "zipf") == 0) {
+				this->access_pattern = ZIPF;
+				i++;
+				if (i == argc) {
+					strncpy(errorString, "exponent of zipf memory access pattern missing", errorStringSize);
+					error = true;
+					break;
+				}
+				this->zipf_exponent = Experiment::parse_real(argv[i]);
+			} else if (strcasecmp(argv[i], "hotcold") == 0) {
+				this->access_pattern = HOTCOLD;
+				i++;
+				if (i == argc) {
+					strncpy(errorString, "hot fraction of hotcold memory access pattern missing", errorStringSize);
+					error = true;
+					break;
+				}
+				this->hot_fraction = Experiment::parse_real(argv[i]);
+				if (this->hot_fraction <= 0 || 1 <= this->hot_fraction) {
+					strncpy(errorString, "invalid hot fraction of hotcold memory access pattern", errorStringSize);
+					error = true;
+					break;
+				}
+				i++;
+				if (i == argc) {
+					strncpy(errorString, "hot share of hotcold memory access pattern missing", errorStringSize);
+					error = true;
+					break;
+				}
+				this->hot_share = Experiment::parse_real(argv[i]);
+				if (this->hot_share <= 0 || 1 <= this->hot_share) {
+					strncpy(errorString, "invalid hot share of hotcold memory access pattern", errorStringSize);
+					error = true;
+					break;
+				}
+			} else if (strcasecmp(argv[i], "trace") == 0) {
+				this->access_pattern = TRACE;
+				i++;
+				if (i == argc) {
+					strncpy(errorString, "file of trace memory access pattern missing", errorStringSize);
+					error = true;
+					break;
+				}
+				this->trace_file = argv[i];
+				if (::access(this->trace_file, R_OK) != 0) {
+					snprintf(errorString, errorStringSize, "cannot read trace file -- '%s'", argv[i]);
+					error = true;
+					break;
+				}
+			} else if (strcasecmp(argv[i], "pages") == 0) {
+				this->access_pattern = PAGES;
+				i++;
+				if (i == argc) {
+					strncpy(errorString, "lines of pages memory access pattern missing", errorStringSize);
+					error = true;
+					break;
+				}
+				this->lines_per_visit = Experiment::parse_number(argv[i]);
+				if (this->lines_per_visit == 0) {
+					strncpy(errorString, "invalid lines of pages memory access pattern", errorStringSize);
+					error = true;
+					break;
+				}
+				i++;
+				if (i == argc) {
+					strncpy(errorString, "page order of pages memory access pattern missing", errorStringSize);
+					error = true;
+					break;
+				}
+				if (strcasecmp(argv[i], "random") == 0) {
+					this->page_stride = 0;
+				} else {
+					this->page_stride = Experiment::parse_number(argv[i]);
+					if (this->page_stride == 0) {
+						strncpy(errorString, "invalid page order of pages memory access pattern", errorStringSize);
+						error = true;
+						break;
+					}
+				}
+			} else if (strcasecmp(argv[i], "conflict") == 0) {
+				this->access_pattern = CONFLICT;
+				i++;
+				if (i == argc) {
+					strncpy(errorString, "stride of conflict memory access pattern missing", errorStringSize);
+					error = true;
+					break;
+				}
+				if (strcasecmp(argv[i], "l1") == 0) {
+					this->conflict_level = 1;
+				} else if (strcasecmp(argv[i], "l2") == 0) {
+					this->conflict_level = 2;
+				} else if (strcasecmp(argv[i], "l3") == 0) {
+					this->conflict_level = 3;
+				} else {
+					this->conflict_stride = Experiment::parse_number(argv[i]);
+					if (this->conflict_stride == 0) {
+						strncpy(errorString, "invalid stride of conflict memory access pattern", errorStringSize);
+						error = true;
+						break;
+					}
+				}
+			} else if (strcasecmp(argv[i], "dram") == 0) {
+				this->access_pattern = DRAM;
+				i++;
+				if (i == argc) {
+					strncpy(errorString, "class of dram memory access pattern missing", errorStringSize);
+					error = true;
+					break;
+				}
+				if (strcasecmp(argv[i], "hit") == 0) {
+					this->dram_class = ROW_HIT;
+				} else if (strcasecmp(argv[i], "conflict") == 0) {
+					this->dram_class = ROW_CONFLICT;
+				} else if (strcasecmp(argv[i], "banks") == 0) {
+					this->dram_class = BANK_SPREAD;
+				} else if (strcasecmp(argv[i], "all") == 0) {
+					this->dram_sweep = true;
+				} else {
+					snprintf(errorString, errorStringSize, "invalid class of dram memory access pattern -- '%s'", argv[i]);
+					error = true;
+					break;
+				}
 			} else {
 				snprintf(errorString, errorStringSize, "invalid type of memory access pattern -- '%s'", argv[i]);
 				error = true;
@@ -362,7 +1048,47 @@ int Experiment::parse_args(int argc, char* argv[]) {
 					error = true;
 					break;
 				}
-				this->placement_map = argv[i];
+				this->placement_map = argv[i];
+			} else if (strcasecmp(argv[i], "interleave") == 0
+					|| strncasecmp(argv[i], "interleave:", 11) == 0) {
+				this->numa_placement = INTERLEAVE;
+				if (argv[i][10] == ':' && !this->parse_nodes(argv[i] + 11, false)) {
+					snprintf(errorString, errorStringSize, "invalid interleaved nodes -- '%s'", argv[i]);
+					error = true;
+					break;
+				}
+			} else if (strncasecmp(argv[i], "weighted:", 9) == 0) {
+				this->numa_placement = WEIGHTED;
+				if (!this->parse_nodes(argv[i] + 9, true)) {
+					snprintf(errorString, errorStringSize, "invalid weighted nodes -- '%s'", argv[i]);
+					error = true;
+					break;
+				}
+			} else if (strncasecmp(argv[i], "tier:", 5) == 0) {
+				this->numa_placement = TIER;
+				char* end = NULL;
+				this->tier_node = strtol(argv[i] + 5, &end, 10);
+				if (*end == ':') {
+					this->tier_fraction = strtod(end + 1, &end);
+				}
+				if (strcasecmp(end, ":cold") == 0) {
+					this->tier_hot = false;
+				} else if (*end != '\0' && strcasecmp(end, ":hot") != 0) {
+					this->tier_fraction = -1;
+				}
+				if (end == argv[i] + 5 || this->tier_node < 0
+						|| this->tier_fraction <= 0 || 1 < this->tier_fraction) {
+					snprintf(errorString, errorStringSize, "invalid tiered placement -- '%s'", argv[i]);
+					error = true;
+					break;
+				}
+			} else if (strncasecmp(argv[i], "split:", 6) == 0) {
+				this->numa_placement = SPLIT;
+				if (!this->parse_nodes(argv[i] + 6, false)) {
+					snprintf(errorString, errorStringSize, "invalid split nodes -- '%s'", argv[i]);
+					error = true;
+					break;
+				}
 			} else {
 				snprintf(errorString, errorStringSize, "invalid numa placement -- '%s'", argv[i]);
 				error = true;
@@ -376,6 +1102,37 @@ int Experiment::parse_args(int argc, char* argv[]) {
 	}
 
 
+	// check the flush instruction against the processor,
+	// falling back to older instructions unless strict
+	if (!error && this->flush_scope != NO_FLUSH) {
+		AsmJit::CpuInfo* cpu = AsmJit::getCpuInfo();
+		int32 requested = this->flush_instruction;
+		if (this->flush_instruction == CLWB
+				&& !(cpu->extendedFeatures & AsmJit::CPU_EXTENDED_FEATURE_CLWB)) {
+			this->flush_instruction = CLFLUSHOPT;
+		}
+		if (this->flush_instruction == CLFLUSHOPT
+				&& !(cpu->extendedFeatures & AsmJit::CPU_EXTENDED_FEATURE_CLFLUSHOPT)) {
+			this->flush_instruction = CLFLUSH;
+		}
+		if (!(cpu->features & AsmJit::CPU_FEATURE_CLFLUSH)) {
+			strncpy(errorString, "flushing is not supported by this processor", errorStringSize);
+			error = true;
+		}
+		if (this->strict && this->flush_instruction != requested) {
+			snprintf(errorString, errorStringSize, "flush instruction not supported by this processor -- '%s'",
+					flush_instruction_string(requested));
+			error = true;
+		}
+	}
+
+	// atomic operations use the words behind the link in every line
+	if (!error && this->atomic_op != NO_ATOMIC
+			&& this->bytes_per_line < 2 * this->pointer_size) {
+		strncpy(errorString, "cache line too small for atomic operations", errorStringSize);
+		error = true;
+	}
+
 	// if we've hit an error, print a message and quit
 	if (error) {
 		printf("chase: %s\n", errorString);
@@ -396,21 +1153,133 @@ int Experiment::parse_args(int argc, char* argv[]) {
 		printf("    [-t|--threads]     <number>    # number of threads (concurrency and contention)\n");
 		printf("    [-i|--iterations]  <number>    # iterations per experiment\n");
 		printf("    [-e|--experiments] <number>    # experiments\n");
+		printf("    [--mlp-sweep]      <number>    # sweep chains per thread from 1 up to <number>\n");
+		printf("    [--thread-sweep]   <number>    # sweep threads from 1 up to <number> (or all)\n");
+		printf("    [--cpus]           <cpus>      # pin threads to the cpus of the list \"c1,c2,...\" in turn\n");
+		printf("    [--page-sweep]     <number>    # sweep pages walked from 1 up to <number>\n");
+		printf("    [--way-sweep]      <number>    # sweep aliasing lines from 1 up to <number>\n");
+		printf("    [--monitor]        <number>    # sample latency and bandwidth every <number> seconds\n");
+		printf("    [--duration]       <number>    # stop monitoring after <number> seconds\n");
+		printf("    [--duty]           <number>    # run for a fraction <number> of every interval\n");
+		printf("    [--prometheus]     <file>      # export every sample to a textfile <file>\n");
 		printf("    [-a|--access]      <pattern>   # memory access pattern\n");
 		printf("    [-o|--output]      <format>    # output format\n");
 		printf("    [-n|--numa]        <placement> # numa placement\n");
 		printf("    [-s|--seconds]     <number>    # run each experiment for <number> seconds\n");
 		printf("    [-g|--loop]        <number>    # cycles to execute for each iteration (latency hiding)\n");
 		printf("    [-f|--prefetch]    <hint>      # use of prefetching\n");
+		printf("    [--flush]          <flush>     # flushing of cache lines (cold misses)\n");
+		printf("    [--atomic]         <atomic>    # atomic read-modify-write on every visited line\n");
+		printf("    [--share]          <sharers>   # threads walking the same chains\n");
+		printf("    [--sibling]        <work>      # run <work> on the smt sibling of the chasing thread\n");
+		printf("    [--backing]        <backing>   # memory backing the chains\n");
+		printf("    [--populate]                   # prefault mapped chains\n");
+		printf("    [--physical]       <mask>      # select or group pages by physical address\n");
+		printf("    [--dram-map]       <map>       # physical address mapping of dram banks and rows\n");
+		printf("    [--page-faults]    <pages>     # time faulting in fresh chains of <pages>\n");
+		printf("    [--migrate]        <migration> # time migrating the chains to another node\n");
+		printf("    [--ring]           <ring>      # stream messages from a producer to consumers\n");
+		printf("    [--dump-jit]       <file>      # write the generated code to <file> and <file>.bin\n");
+		printf("    [--save-chain]     <file>      # save the chains to <file> once built\n");
+		printf("    [--load-chain]     <file>      # load the chains from <file> rather than building them\n");
 		printf("    [-x|--strict]                  # fail rather than adjust options to sensible values\n");
+		printf("    [--recalibrate]                # calibrate the timer rather than reuse a cached calibration\n");
 		printf("\n");
 		printf("<pattern> is selected from the following:\n");
 		printf("    random                         # all chains are accessed randomly\n");
 		printf("    forward <stride>               # chains are in forward order with constant stride\n");
 		printf("    reverse <stride>               # chains are in reverse order with constant stride\n");
 		printf("\n");
+		printf("    zipf <exponent>                # lines are visited with zipf distributed frequencies\n");
+		printf("    hotcold <fraction> <share>     # a <fraction> of hot lines receives a <share> of the visits\n");
+		printf("    trace <file>                   # chains replay the addresses recorded in <file>\n");
+		printf("    pages <lines> <order>          # visit <lines> random lines of every page, pages in <order>\n");
+		printf("    conflict <stride>              # visit lines <stride> bytes apart, aliasing to one cache set\n");
+		printf("    dram <class>                   # visit lines of one dram row, bank or every bank\n");
+		printf("\n");
 		printf("Note: <stride> is always a small positive integer.\n");
 		printf("\n");
+		printf("The pages pattern measures the cost of translation: every page walked\n");
+		printf("takes a TLB miss once the pages outgrow the reach of the TLB, shared\n");
+		printf("only by <lines> accesses rather than by all lines of the page. <order>\n");
+		printf("is random, or a page stride visiting every <order>th page. Walks of few\n");
+		printf("pages repeat through the links within the lines and then through more\n");
+		printf("lines of the pages, so a walk takes enough loads to hide the overhead\n");
+		printf("of the call. A page sweep walks 1, 2, 4, ... up to <number> pages and\n");
+		printf("reports the time per page walked; compare 4k, thp and hugetlb backings,\n");
+		printf("and set the page size to the huge page size to measure the reach of huge\n");
+		printf("page entries.\n");
+		printf("\n");
+		printf("The conflict pattern visits lines that map to the same set of a cache,\n");
+		printf("in random order, repeating them through the links within every line and\n");
+		printf("then through as many lines of the following sets, so a walk takes enough\n");
+		printf("loads to hide the overhead of the call. <stride> is l1, l2 or l3 for the\n");
+		printf("size of the level divided by its associativity, or a number of bytes.\n");
+		printf("A way sweep walks 1, 2, 3, ... up to <number> lines per set; the latency\n");
+		printf("jumps once the lines outnumber the ways of the set, revealing the\n");
+		printf("associativity and the cost of a conflict miss. Strides beyond a page\n");
+		printf("alias only physically, so back the chains with thp or hugetlb pages for\n");
+		printf("l2 and l3; sliced last level caches hash addresses, which blurs their\n");
+		printf("sets.\n");
+		printf("\n");
+		printf("The dram pattern classifies every line of the chain by its physical\n");
+		printf("address, using the mapping given by --dram-map, and visits in random\n");
+		printf("order the lines of one row (hit), single lines of the rows of one\n");
+		printf("bank (conflict), or the lines of one row in every bank, switching banks\n");
+		printf("on every visit (banks); all walks every class in turn and reports the\n");
+		printf("row miss penalty. Lines are flushed once visited, unless chain flushes\n");
+		printf("are selected, so every visit reaches dram. <map> has the\n");
+		printf("form \"<bank bit>,<bank bit>,...:<row>\", where every bank bit is the\n");
+		printf("parity of the address bits under its mask, and <row> masks the row bits,\n");
+		printf("for example \"0x2040,0x24000,0x48000,0x90000:0x3fffe0000\". Physical\n");
+		printf("addresses are read from /proc/self/pagemap, which requires CAP_SYS_ADMIN.\n");
+		printf("\n");
+		printf("Skewed patterns visit a line several times per iteration through the\n");
+		printf("different links within it, so no line is visited more often than there\n");
+		printf("are links per line. Zipf ranks lines randomly and draws as many visits\n");
+		printf("as there are lines, so the coldest lines may not be visited at all;\n");
+		printf("an exponent that needs more visits of the hottest lines flattens the\n");
+		printf("distribution, which fails if strict and is reported as the share of the\n");
+		printf("visits going to the top 1%% of lines otherwise.\n");
+		printf("Hotcold visits every cold line once; a share that needs more visits of\n");
+		printf("the hot lines is reduced to the largest possible one, unless strict.\n");
+		printf("<exponent>, <fraction> and <share> are real numbers, the latter two\n");
+		printf("lie between 0 and 1.\n");
+		printf("\n");
+		printf("A trace holds either one address per text line (decimal, or hexadecimal\n");
+		printf("with a 0x prefix; further fields and lines starting with # are ignored)\n");
+		printf("or raw 64-bit addresses in native byte order. The trace is streamed,\n");
+		printf("and pages are mapped onto the pages of the chain in order of first use,\n");
+		printf("keeping the position of every line within its page, so page and line\n");
+		printf("reuse distances are preserved. Every visit of a line uses another link\n");
+		printf("within it, and repeat visits of the line just visited count once; the\n");
+		printf("replay stops when a line runs out of links, when the trace touches more\n");
+		printf("pages than the chain holds, or at the end of the trace, and fails rather\n");
+		printf("than stop early if strict.\n");
+		printf("\n");
+		printf("An MLP sweep runs every number of chains per thread in turn, using the same\n");
+		printf("threads and memory, and reports the number of outstanding misses achieved\n");
+		printf("(by Little's law, relative to the latency of a single chain) together with\n");
+		printf("the point where throughput saturates for each cache level the working set\n");
+		printf("falls in. The limit replaces -r, but not the chains of a numa map.\n");
+		printf("\n");
+		printf("A monitor runs the experiment indefinitely, or for the given duration,\n");
+		printf("and streams the latency and bandwidth of every interval. Every thread\n");
+		printf("walks its chains for the duty cycle of the interval and then sleeps,\n");
+		printf("which caps the bandwidth a monitor consumes. An interval always holds\n");
+		printf("at least one walk of every chain.\n");
+		printf("\n");
+		printf("A monitor can export its samples to a node_exporter textfile, which\n");
+		printf("is replaced atomically after every interval. The file holds the latency\n");
+		printf("and bandwidth of the last interval, overall and per numa node, and a\n");
+		printf("histogram of the latency of every walk since the monitor started.\n");
+		printf("\n");
+		printf("A thread sweep runs every number of threads in turn, filling the cpus of\n");
+		printf("one socket before moving on to the next, and reports the bandwidth and\n");
+		printf("latency of all threads and of every socket, together with the point where\n");
+		printf("bandwidth saturates. The limit replaces -t, and \"all\" sweeps up to the\n");
+		printf("number of cpus available.\n");
+		printf("\n");
 		printf("<format> is selected from the following:\n");
 		printf("    hdr                            # csv header only\n");
 		printf("    csv                            # results in csv format only\n");
@@ -424,11 +1293,163 @@ int Experiment::parse_args(int argc, char* argv[]) {
 		printf("    t1                             # use the T1 hint (prefetch into all caches except L1)\n");
 		printf("    t2                             # use the T2 hint (prefetch into all caches except L1 & L2)\n");
 		printf("\n");
+		printf("<flush> is selected from the following:\n");
+		printf("    none                           # do not flush cache lines\n");
+		printf("    line <instruction>             # flush every line right after it is visited\n");
+		printf("    chain <instruction>            # flush the whole chain between iterations (not timed)\n");
+		printf("\n");
+		printf("<instruction> is selected from the following:\n");
+		printf("    clflush                        # flush and invalidate, strongly ordered\n");
+		printf("    clflushopt                     # flush and invalidate, weakly ordered\n");
+		printf("    clwb                           # write back, the line may be retained\n");
+		printf("\n");
+		printf("Note: unsupported instructions fall back to clflushopt or clflush.\n");
+		printf("\n");
+		printf("<backing> is selected from the following:\n");
+		printf("    anon                           # anonymous heap memory\n");
+		printf("    4k                             # anonymous base pages (transparent huge pages disabled)\n");
+		printf("    thp                            # anonymous transparent huge pages\n");
+		printf("    hugetlb                        # anonymous pages from the hugetlb pool\n");
+		printf("    shm                            # shared memory segments (tmpfs)\n");
+		printf("    file:<dir>                     # files in <dir>, held in the page cache\n");
+		printf("    dax:<dir>                      # files in <dir> on a dax file system, mapped synchronously\n");
+		printf("\n");
+		printf("Note: a segment or file is created for every chain and removed once mapped.\n");
+		printf("\n");
+		printf("<mask> selects bits of the physical address of a page, such as its cache\n");
+		printf("color or dram channel bits. \"<mask>=<value>\" builds the chains only from\n");
+		printf("pages whose masked bits equal <value>, from a pool of pages large enough\n");
+		printf("to find them; a plain <mask> visits the pages grouped by their masked\n");
+		printf("bits. Masks and values may be hexadecimal, and cannot select bits within\n");
+		printf("a page. Physical addresses are read from /proc/self/pagemap, which\n");
+		printf("requires CAP_SYS_ADMIN. Heap memory is replaced by 4k mappings, and\n");
+		printf("the chains are built as usual before their pages are relocated.\n");
+		printf("\n");
+		printf("<pages> is selected from the following:\n");
+		printf("    4k                             # base pages (transparent huge pages disabled)\n");
+		printf("    thp                            # transparent huge pages\n");
+		printf("    hugetlb                        # pages from the hugetlb pool\n");
+		printf("    <pages>:unbound                # <pages> not bound to the numa domains of the chains\n");
+		printf("\n");
+		printf("Page fault mode maps every chain afresh for each experiment and times\n");
+		printf("mapping it and writing to each of its base pages in address order,\n");
+		printf("reporting the faults taken and the time per fault of every thread.\n");
+		printf("With --populate the faults are taken by the mapping itself. Chains\n");
+		printf("are bound to their numa domains like chased chains, outside the timed\n");
+		printf("window, unless unbound, which leaves the pages to the default policy\n");
+		printf("of the thread to compare the cost of binding.\n");
+		printf("\n");
+		printf("<migration> is selected from the following:\n");
+		printf("    <node>[:chase]                 # move_pages, page by page\n");
+		printf("    <node>:<pages>[:chase]         # move_pages, <pages> at a time\n");
+		printf("    <node>:bulk                    # migrate_pages, the whole process at once\n");
+		printf("\n");
+		printf("Migration mode builds the chains in their numa domains, then moves\n");
+		printf("them to <node> and back to their domains in turn, one experiment at\n");
+		printf("a time. Every experiment reports the pages moved, the migration\n");
+		printf("throughput, the longest call (the pause of a thread waiting on its\n");
+		printf("memory) and the latency of walks before and after the move; with\n");
+		printf("chase every call is followed by a walk of the chains, timing the\n");
+		printf("latency during the move. Pages are counted in base pages; thp and\n");
+		printf("hugetlb backings migrate whole huge pages. <node> cannot be a domain\n");
+		printf("of the chains, and bulk migration, which maps nodes onto nodes, needs\n");
+		printf("all chains in one domain. Requires a numa build.\n");
+		printf("\n");
+		printf("<ring> has the form \"<slots>[:<bytes>[:<batch>]]\": a ring of <slots>\n");
+		printf("slots of <bytes> each (a power of two, 64 by default), to which the\n");
+		printf("first thread writes time-stamped messages, <batch> at a time (1 by\n");
+		printf("default). All other threads poll the ring and read every message,\n");
+		printf("releasing their slots <batch> at a time, and the first thread waits\n");
+		printf("for the slowest of them before it reuses a slot. Every experiment\n");
+		printf("runs for the given seconds, or <iterations> times around the ring,\n");
+		printf("and reports the messages and throughput of every thread with the\n");
+		printf("mean and least latency from writing a message to reading it. The\n");
+		printf("ring lives in the domain of the first thread; place threads with\n");
+		printf("--cpus or a numa map.\n");
+		printf("\n");
+		printf("<atomic> is selected from the following:\n");
+		printf("    none                           # plain loads only\n");
+		printf("    <op> padded                    # every thread updates its own chains\n");
+		printf("    <op> shared                    # all threads update the same word of the same chains\n");
+		printf("    <op> false                     # all threads update their own word of the same chains\n");
+		printf("\n");
+		printf("Atomic operations update the words behind the link of every line, so\n");
+		printf("they require the random, forward or reverse access pattern, whose\n");
+		printf("chains use only the first link of a line, and cannot be combined with\n");
+		printf("loaded chains.\n");
+		printf("\n");
+		printf("<sharers> is selected from the following:\n");
+		printf("    <n>[:<node>][:offset]          # groups of <n> threads walk the same chains\n");
+		printf("    all[:<node>][:offset]          # all threads walk the same chains\n");
+		printf("\n");
+		printf("The first thread of every group builds the chains, in its numa\n");
+		printf("domain or on <node>, and the others walk them too, from the first\n");
+		printf("link or, with offset, evenly spaced along the cycle. Latencies are\n");
+		printf("reported for every thread; a thread sweep sharing all chains\n");
+		printf("reports the latency for every number of sharers.\n");
+		printf("\n");
+		printf("<work> is selected from the following:\n");
+		printf("    compute                        # a dependent chain of multiplications\n");
+		printf("    chase                          # chasing chains of its own\n");
+		printf("    stream                         # reading its chain memory in order\n");
+		printf("\n");
+		printf("Sibling mode runs two threads on the hardware threads of one core,\n");
+		printf("the first listed cpu (or the first cpu) and its smt sibling. Every\n");
+		printf("experiment times the first thread chasing its chains while the\n");
+		printf("sibling sleeps, then again while the sibling runs <work>, and\n");
+		printf("reports the latency and rate of both and the penalty of sharing the\n");
+		printf("core. An mlp sweep measures the penalty for every number of chains.\n");
+		printf("Any other number of threads is overridden, or fails if strict.\n");
+		printf("\n");
+		printf("<op> is selected from the following:\n");
+		printf("    xadd                           # lock xadd, fetch and add\n");
+		printf("    cmpxchg                        # lock cmpxchg, compare and swap\n");
+		printf("    xchg                           # xchg, exchange (implicitly locked)\n");
+		printf("\n");
+		printf("Note: shared and false layouts walk the chains of the first thread,\n");
+		printf("and false sharing supports up to one less thread than links per line\n");
+		printf("before threads start sharing words again.\n");
+		printf("\n");
+		printf("A chain file records the order of the links of every chain together\n");
+		printf("with the line, page and chain sizes and the access pattern they were\n");
+		printf("built with; loading it overrides those options. Threads and chains\n");
+		printf("beyond those in the file reuse its chains in turn.\n");
+		printf("\n");
+		printf("The timer is calibrated over several short windows, discarding outliers,\n");
+		printf("and the calibration is cached in $XDG_CACHE_HOME/pchase-timer (or\n");
+		printf("~/.cache/pchase-timer) for later runs on the same cpu model until the\n");
+		printf("next boot, unless --recalibrate is given.\n");
+		printf("\n");
+		printf("The listing written by --dump-jit records the base address of the code,\n");
+		printf("so <file>.bin can be disassembled with a command such as\n");
+		printf("\"objdump -D -b binary -m i386:x86-64 --adjust-vma=<base> <file>.bin\".\n");
+		printf("An mlp sweep dumps the code of every step to <file>.<chains>.\n");
+		printf("\n");
 		printf("<placement> is selected from the following:\n");
 		printf("    local                          # all chains are allocated locally\n");
 		printf("    xor <mask>                     # exclusive OR and mask\n");
 		printf("    add <offset>                   # addition and offset\n");
 		printf("    map <map>                      # explicit mapping of threads and chains to domains\n");
+		printf("    interleave[:<nodes>]           # pages of every chain interleaved over <nodes> (or all)\n");
+		printf("    weighted:<node=weight,...>     # pages of every chain interleaved in proportion to weights\n");
+		printf("    split:<nodes>                  # every chain split into equal contiguous parts over <nodes>\n");
+		printf("    tier:<node>:<frac>[:hot|cold]  # a fraction <frac> of the pages of every chain on <node>\n");
+		printf("\n");
+		printf("<nodes> is a list of NUMA domains such as \"0,1\". Interleaved placement\n");
+		printf("applies the kernel's page-granular round-robin policy to every chain,\n");
+		printf("weighted placement places <weight> consecutive pages on each node in\n");
+		printf("turn, and split placement binds an equal contiguous share of every\n");
+		printf("chain to each node. Threads run on their domains as with local\n");
+		printf("placement; transparent huge pages place 2MB at a time. All three\n");
+		printf("require a numa build.\n");
+		printf("\n");
+		printf("Tiered placement moves a fraction <frac> of the pages of every chain to\n");
+		printf("the far tier <node>, such as a memory-only cxl node, once the chain is\n");
+		printf("built: the most visited pages when hot (the default), the least\n");
+		printf("visited when cold. Skewed access patterns make the difference; the\n");
+		printf("share of the visits served by the far tier is reported with the\n");
+		printf("blended latency. Threads never run on memory-only nodes. Tiered\n");
+		printf("placement requires a numa build.\n");
 		printf("\n");
 		printf("<map> has the form \"t1:c11,c12,...,c1m;t2:c21,...,c2m;...;tn:cn1,...,cnm\"\n");
 		printf("where t[i] is the NUMA domain where the ith thread is run,\n");
@@ -453,6 +1474,225 @@ int Experiment::parse_args(int argc, char* argv[]) {
 
 	// STRICT -- fail if specifications are inconsistent
 
+	// loaded chains dictate the layout and access pattern
+	if (this->load_chain != NULL) {
+		this->chain_file = new ChainFile();
+		if (!this->chain_file->open(this->load_chain)) {
+			printf("chase: cannot load chain file -- '%s'\n", this->load_chain);
+			printf("Try 'chase --help' for more information.\n");
+			return 1;
+		}
+		const ChainFile::Header& h = this->chain_file->header();
+		if (h.pointer_size != this->pointer_size) {
+			printf("chase: chain file built with another pointer size -- '%s'\n", this->load_chain);
+			printf("Try 'chase --help' for more information.\n");
+			return 1;
+		}
+		this->bytes_per_line  = h.bytes_per_line;
+		this->bytes_per_page  = h.bytes_per_page;
+		this->bytes_per_chain = h.bytes_per_chain;
+		this->access_pattern  = (__typeof__(this->access_pattern)) h.access_pattern;
+		this->stride          = h.stride;
+		this->zipf_exponent   = h.zipf_exponent;
+		this->hot_fraction    = h.hot_fraction;
+		this->hot_share       = h.hot_share;
+		this->trace_file      = NULL;
+	}
+
+	// atomic operations would overwrite the links of patterns
+	// that chain several links within a line
+	if (this->atomic_op != NO_ATOMIC
+			&& ((this->access_pattern != RANDOM && this->access_pattern != STRIDED)
+					|| this->load_chain != NULL)) {
+		printf("chase: atomic operations require the random, forward or reverse access pattern and cannot be combined with loaded chains\n");
+		printf("Try 'chase --help' for more information.\n");
+		return 1;
+	}
+
+	// a thread sweep sets up threads up to its limit
+	if (0 < this->thread_sweep
+			&& (0 < this->mlp_sweep || this->page_faults != NO_FAULTS
+					|| this->save_chain != NULL)) {
+		printf("chase: thread sweeps cannot be combined with mlp sweeps, page faults or saved chains\n");
+		printf("Try 'chase --help' for more information.\n");
+		return 1;
+	}
+	if (0 < this->monitor_interval
+			&& (0 < this->mlp_sweep || 0 < this->thread_sweep
+					|| 0 < this->page_sweep || 0 < this->way_sweep
+					|| this->page_faults != NO_FAULTS)) {
+		printf("chase: monitors cannot be combined with sweeps or page faults\n");
+		printf("Try 'chase --help' for more information.\n");
+		return 1;
+	}
+	if (this->access_pattern == DRAM && this->dram_banks == NULL) {
+		printf("chase: the dram access pattern requires a dram address mapping\n");
+		printf("Try 'chase --help' for more information.\n");
+		return 1;
+	}
+	if (this->dram_sweep
+			&& (0 < this->mlp_sweep || 0 < this->thread_sweep
+					|| 0 < this->monitor_interval
+					|| this->page_faults != NO_FAULTS
+					|| this->load_chain != NULL)) {
+		printf("chase: dram classes cannot be combined with sweeps, monitors, page faults or loaded chains\n");
+		printf("Try 'chase --help' for more information.\n");
+		return 1;
+	}
+	if (0 < this->way_sweep && this->access_pattern != CONFLICT) {
+		printf("chase: way sweeps require the conflict access pattern\n");
+		printf("Try 'chase --help' for more information.\n");
+		return 1;
+	}
+	if (0 < this->way_sweep
+			&& (0 < this->mlp_sweep || 0 < this->thread_sweep
+					|| 0 < this->page_sweep || 0 < this->monitor_interval
+					|| this->page_faults != NO_FAULTS
+					|| this->load_chain != NULL)) {
+		printf("chase: way sweeps cannot be combined with other sweeps, monitors, page faults or loaded chains\n");
+		printf("Try 'chase --help' for more information.\n");
+		return 1;
+	}
+	if (0 < this->page_sweep && this->access_pattern != PAGES) {
+		printf("chase: page sweeps require the pages access pattern\n");
+		printf("Try 'chase --help' for more information.\n");
+		return 1;
+	}
+	if (0 < this->page_sweep
+			&& (0 < this->mlp_sweep || 0 < this->thread_sweep
+					|| 0 < this->monitor_interval
+					|| this->page_faults != NO_FAULTS
+					|| this->load_chain != NULL)) {
+		printf("chase: page sweeps cannot be combined with other sweeps, monitors, page faults or loaded chains\n");
+		printf("Try 'chase --help' for more information.\n");
+		return 1;
+	}
+	if (0 <= this->migrate_node
+			&& (0 < this->mlp_sweep || 0 < this->thread_sweep
+					|| 0 < this->page_sweep || 0 < this->way_sweep
+					|| this->dram_sweep || 0 < this->monitor_interval
+					|| this->page_faults != NO_FAULTS || this->share_threads != 0
+					|| (this->atomic_op != NO_ATOMIC && this->atomic_layout != PADDED))) {
+		printf("chase: migration cannot be combined with sweeps, monitors, page faults or shared chains\n");
+		printf("Try 'chase --help' for more information.\n");
+		return 1;
+	}
+	if (this->share_threads != 0 && this->page_faults != NO_FAULTS) {
+		printf("chase: shared chains cannot be combined with page faults\n");
+		printf("Try 'chase --help' for more information.\n");
+		return 1;
+	}
+	if (0 < this->ring_slots
+			&& (0 < this->mlp_sweep || 0 < this->thread_sweep
+					|| 0 < this->page_sweep || 0 < this->way_sweep
+					|| this->dram_sweep || 0 < this->monitor_interval
+					|| this->page_faults != NO_FAULTS || 0 <= this->migrate_node
+					|| this->share_threads != 0)) {
+		printf("chase: rings cannot be combined with sweeps, monitors, page faults, migration or shared chains\n");
+		printf("Try 'chase --help' for more information.\n");
+		return 1;
+	}
+	if (0 < this->ring_slots && this->num_threads < 2) {
+		printf("chase: a ring requires a producer and at least one consumer thread\n");
+		printf("Try 'chase --help' for more information.\n");
+		return 1;
+	}
+	if (this->sibling_work != NO_SIBLING
+			&& (0 < this->thread_sweep || 0 < this->page_sweep
+					|| 0 < this->way_sweep || this->dram_sweep
+					|| 0 < this->monitor_interval
+					|| this->page_faults != NO_FAULTS || 0 <= this->migrate_node
+					|| 0 < this->ring_slots
+					|| this->share_threads != 0
+					|| (this->atomic_op != NO_ATOMIC && this->atomic_layout != PADDED))) {
+		printf("chase: siblings cannot be combined with sweeps other than mlp, monitors, page faults, migration, rings or shared chains\n");
+		printf("Try 'chase --help' for more information.\n");
+		return 1;
+	}
+	// a sibling runs the chasing thread and its sibling,
+	// overriding any other number of threads
+	if (this->sibling_work != NO_SIBLING) {
+		if (this->num_threads != DEFAULT_THREADS && this->num_threads != 2) {
+			if (this->strict) {
+				printf("chase: siblings run exactly two threads\n");
+				printf("Try 'chase --help' for more information.\n");
+				return 1;
+			}
+			fprintf(stderr, "chase: siblings run two threads, not %lld\n", this->num_threads);
+		}
+		this->num_threads = 2;
+	}
+	if (this->migrate_bulk && this->migrate_chase) {
+		printf("chase: bulk migration moves the whole process and cannot chase the chains\n");
+		printf("Try 'chase --help' for more information.\n");
+		return 1;
+	}
+#if !defined(NUMA)
+	if (this->numa_placement == INTERLEAVE || this->numa_placement == WEIGHTED
+			|| this->numa_placement == SPLIT) {
+		printf("chase: interleaved, weighted and split placement require a build with numa support\n");
+		printf("Try 'chase --help' for more information.\n");
+		return 1;
+	}
+	if (this->numa_placement == TIER) {
+		printf("chase: tiered placement requires a build with numa support\n");
+		printf("Try 'chase --help' for more information.\n");
+		return 1;
+	}
+	if (0 <= this->migrate_node) {
+		printf("chase: migration requires a build with numa support\n");
+		printf("Try 'chase --help' for more information.\n");
+		return 1;
+	}
+#endif
+	if (this->prometheus_file != NULL && this->monitor_interval <= 0) {
+		printf("chase: a prometheus textfile requires a monitor\n");
+		printf("Try 'chase --help' for more information.\n");
+		return 1;
+	}
+	if (0 < this->thread_sweep) {
+		this->num_threads = this->thread_sweep;
+	}
+
+	// an mlp sweep allocates chains up to its limit
+	if (0 < this->mlp_sweep) {
+		this->chains_per_thread = this->mlp_sweep;
+	}
+
+	// a page sweep allocates the pages of its last step
+	if (0 < this->page_sweep) {
+		this->bytes_per_chain = this->bytes_per_page * this->page_sweep
+				* std::max(this->page_stride, (int64) 1);
+	}
+
+	// the conflict pattern strides by the sets of a cache
+	// level unless given a stride, rounded up to whole lines,
+	// and a way sweep allocates the lines of its last step
+	if (this->access_pattern == CONFLICT) {
+		if (0 < this->conflict_level) {
+			int size = this->conflict_level == 1 ? _SC_LEVEL1_DCACHE_SIZE
+					: this->conflict_level == 2 ? _SC_LEVEL2_CACHE_SIZE
+					: _SC_LEVEL3_CACHE_SIZE;
+			int assoc = this->conflict_level == 1 ? _SC_LEVEL1_DCACHE_ASSOC
+					: this->conflict_level == 2 ? _SC_LEVEL2_CACHE_ASSOC
+					: _SC_LEVEL3_CACHE_ASSOC;
+			long bytes = sysconf(size);
+			long ways = sysconf(assoc);
+			if (bytes <= 0 || ways <= 0) {
+				printf("chase: cannot determine the geometry of the l%d cache\n", this->conflict_level);
+				printf("Try 'chase --help' for more information.\n");
+				return 1;
+			}
+			this->conflict_stride = bytes / ways;
+		}
+		this->conflict_stride = (this->conflict_stride + this->bytes_per_line - 1)
+				/ this->bytes_per_line * this->bytes_per_line;
+		if (0 < this->way_sweep) {
+			this->bytes_per_chain = this->conflict_stride * this->way_sweep;
+		}
+		this->bytes_per_chain = std::max(this->bytes_per_chain, this->conflict_stride);
+	}
+
 	// compute lines per page and lines per chain
 	// based on input and defaults.
 	// we round up page and chain sizes when needed.
@@ -467,6 +1707,106 @@ int Experiment::parse_args(int argc, char* argv[]) {
 	this->lines_per_chain  = this->lines_per_page * this->pages_per_chain;
 	this->links_per_chain  = this->lines_per_chain * this->links_per_line;
 
+	// the pages pattern walks every page, or every
+	// <stride>th page, visiting up to all of its lines
+	if (this->access_pattern == PAGES) {
+		if (this->lines_per_page < this->lines_per_visit) {
+			if (this->strict) {
+				printf("chase: more lines of pages memory access pattern than lines per page\n");
+				printf("Try 'chase --help' for more information.\n");
+				return 1;
+			}
+			this->lines_per_visit = this->lines_per_page;
+		}
+		int64 stride = std::max(this->page_stride, (int64) 1);
+		this->pages_per_walk = (this->pages_per_chain + stride - 1) / stride;
+	}
+
+	// the conflict pattern visits every aliasing line of the chain
+	if (this->access_pattern == CONFLICT) {
+		this->conflict_ways = this->bytes_per_chain / this->conflict_stride;
+	}
+
+	// chains placed or classified by physical address are
+	// built in page aligned memory, from a pool holding enough
+	// pages with every value of the masked bits, plus a margin
+	if (this->physical_mask != 0 || this->access_pattern == DRAM) {
+		if (this->physical_mask != 0
+				&& (this->page_faults != NO_FAULTS || this->save_chain != NULL)) {
+			printf("chase: physical placement cannot be combined with page faults or saved chains\n");
+			printf("Try 'chase --help' for more information.\n");
+			return 1;
+		}
+		if (!PageMap::readable()) {
+			printf("chase: cannot read physical addresses from /proc/self/pagemap\n");
+			printf("Try 'chase --help' for more information.\n");
+			return 1;
+		}
+		if (this->memory_backing == ANON_BACKING) {
+			this->memory_backing = BASE_BACKING;
+		}
+		this->physical_pages = this->pages_per_chain;
+		if (this->physical_select) {
+			int64 values = (int64) 1 << __builtin_popcountll(this->physical_mask);
+			this->physical_pages = this->pages_per_chain * values
+					+ this->pages_per_chain * values / 4 + 16;
+		}
+	}
+
+	// the dram pattern flushes lines so every visit reaches dram
+	if (this->access_pattern == DRAM && this->flush_scope == NO_FLUSH) {
+		this->flush_scope = LINE_FLUSH;
+	}
+
+	// hot lines cannot be visited more often than they have links
+	if (this->access_pattern == HOTCOLD
+			&& this->links_per_line < this->hot_visits()) {
+		if (this->strict) {
+			printf("chase: hot share of hotcold memory access pattern too large\n");
+			printf("Try 'chase --help' for more information.\n");
+			return 1;
+		}
+		float cold = 1 - this->hot_fraction;
+		this->hot_share = this->links_per_line * this->hot_fraction
+				/ (this->links_per_line * this->hot_fraction + cold);
+	}
+
+	// the most frequent zipf lines cannot be visited more often
+	// than they have links either, which flattens the distribution,
+	// so report the share of the visits the top 1% of lines receive
+	if (this->access_pattern == ZIPF) {
+		int64 top_lines = std::max((int64) 1, this->lines_per_chain / 100);
+		double harmonic = 0;
+		for (int64 r = 1; r <= this->lines_per_chain; r++) {
+			harmonic += pow((double) r, -this->zipf_exponent);
+		}
+		double top = 0;
+		double total = 0;
+		bool capped = false;
+		for (int64 r = 1; r <= this->lines_per_chain; r++) {
+			double expected = this->lines_per_chain
+					* pow((double) r, -this->zipf_exponent) / harmonic;
+			if (this->links_per_line < expected) {
+				expected = this->links_per_line;
+				capped = true;
+			}
+			if (r <= top_lines)
+				top += expected;
+			total += expected;
+		}
+		if (capped) {
+			if (this->strict) {
+				printf("chase: exponent of zipf memory access pattern too large\n");
+				printf("Try 'chase --help' for more information.\n");
+				return 1;
+			}
+			fprintf(stderr, "chase: zipf lines are visited at most %lld times, "
+					"the top 1%% of lines receive %.1f%% of the visits\n",
+					this->links_per_line, 100 * top / total);
+		}
+		this->zipf_share = top / total;
+	}
+
 
 	// allocate the chain roots for all threads
 	// and compute the chain locations
@@ -475,6 +1815,10 @@ int Experiment::parse_args(int argc, char* argv[]) {
 	case LOCAL:
 	case XOR:
 	case ADD:
+	case INTERLEAVE:
+	case WEIGHTED:
+	case SPLIT:
+	case TIER:
 		this->thread_domain = new int32[this->num_threads];
 		this->chain_domain = new int32*[this->num_threads];
 		this->random_state = new char*[this->num_threads];
@@ -497,6 +1841,10 @@ int Experiment::parse_args(int argc, char* argv[]) {
 
 	switch (this->numa_placement) {
 	case LOCAL:
+	case INTERLEAVE:
+	case WEIGHTED:
+	case SPLIT:
+	case TIER:
 	default:
 		this->alloc_local();
 		break;
@@ -511,9 +1859,168 @@ int Experiment::parse_args(int argc, char* argv[]) {
 		break;
 	}
 
+	if (this->numa_placement == TIER
+			&& this->num_numa_domains <= this->tier_node) {
+		printf("chase: numa domain %d does not exist\n", this->tier_node);
+		printf("Try 'chase --help' for more information.\n");
+		return 1;
+	}
+	if (this->num_numa_domains <= this->migrate_node) {
+		printf("chase: numa domain %d does not exist\n", this->migrate_node);
+		printf("Try 'chase --help' for more information.\n");
+		return 1;
+	}
+
+	// shared chains live on their chosen node
+	if (this->share_threads != 0 && 0 <= this->share_node) {
+		if (this->num_numa_domains <= this->share_node) {
+			printf("chase: numa domain %d does not exist\n", this->share_node);
+			printf("Try 'chase --help' for more information.\n");
+			return 1;
+		}
+		for (int i = 0; i < this->num_threads; i++) {
+			for (int j = 0; j < this->chains_per_thread; j++) {
+				this->chain_domain[i][j] = this->share_node;
+			}
+		}
+	}
+
+	// chains spread over several nodes, all of them unless
+	// listed, report the first of them as their domain
+	if (this->numa_placement == INTERLEAVE || this->numa_placement == WEIGHTED
+			|| this->numa_placement == SPLIT) {
+		if (this->num_placement_nodes == 0) {
+			this->num_placement_nodes = this->num_numa_domains;
+			this->placement_nodes = new int32[this->num_placement_nodes];
+			this->placement_weights = new int32[this->num_placement_nodes];
+			for (int i = 0; i < this->num_placement_nodes; i++) {
+				this->placement_nodes[i] = i;
+				this->placement_weights[i] = 1;
+			}
+		}
+		for (int i = 0; i < this->num_placement_nodes; i++) {
+			if (this->num_numa_domains <= this->placement_nodes[i]) {
+				printf("chase: numa domain %d does not exist\n", this->placement_nodes[i]);
+				printf("Try 'chase --help' for more information.\n");
+				return 1;
+			}
+		}
+		for (int i = 0; i < this->num_threads; i++) {
+			for (int j = 0; j < this->chains_per_thread; j++) {
+				this->chain_domain[i][j] = this->placement_nodes[0];
+			}
+		}
+	}
+
+	// threads run on the listed cpus in turn
+	if (0 < this->num_listed_cpus) {
+		this->thread_cpu = new int32[this->num_threads];
+		for (int i = 0; i < this->num_threads; i++) {
+			this->thread_cpu[i] = this->listed_cpus[i % this->num_listed_cpus];
+		}
+	}
+
+	// the chasing thread and its sibling share a core, and
+	// their chains the node of the core
+	if (this->sibling_work != NO_SIBLING) {
+		std::vector<int32> cpus = Topology::cpus();
+		int32 cpu = this->thread_cpu != NULL ? this->thread_cpu[0] : cpus[0];
+		int32 sibling = Topology::sibling(cpu);
+		if (sibling < 0 || std::find(cpus.begin(), cpus.end(), sibling) == cpus.end()) {
+			printf("chase: cpu %d has no smt sibling to run on\n", cpu);
+			printf("Try 'chase --help' for more information.\n");
+			return 1;
+		}
+		if (this->thread_cpu == NULL)
+			this->thread_cpu = new int32[this->num_threads];
+		this->thread_cpu[0] = cpu;
+		this->thread_cpu[1] = sibling;
+#if defined(NUMA)
+		for (int i = 0; i < this->num_threads; i++) {
+			this->thread_domain[i] = numa_node_of_cpu(this->thread_cpu[i]);
+			for (int j = 0; j < this->chains_per_thread; j++) {
+				this->chain_domain[i][j] = this->thread_domain[i];
+			}
+		}
+#endif
+	}
+
+	// a thread sweep fills one socket after the other
+	if (0 < this->thread_sweep && this->thread_cpu == NULL) {
+		std::vector<int32> cpus = Topology::cpus();
+		this->thread_cpu = new int32[this->num_threads];
+		for (int i = 0; i < this->num_threads; i++) {
+			this->thread_cpu[i] = cpus[i % cpus.size()];
+		}
+	}
+
+	// chains migrate away from their domains and back,
+	// and bulk migration maps their one domain onto the node
+	if (0 <= this->migrate_node) {
+		bool single = true;
+		for (int i = 0; i < this->num_threads; i++) {
+			for (int j = 0; j < this->chains_per_thread; j++) {
+				if (this->chain_domain[i][j] == this->migrate_node) {
+					printf("chase: numa domain %d holds chains and cannot be migrated to\n", this->migrate_node);
+					printf("Try 'chase --help' for more information.\n");
+					return 1;
+				}
+				single = single && this->chain_domain[i][j] == this->chain_domain[0][0];
+			}
+		}
+		for (int i = 0; i < this->num_placement_nodes; i++) {
+			if (this->placement_nodes[i] == this->migrate_node) {
+				printf("chase: numa domain %d holds chains and cannot be migrated to\n", this->migrate_node);
+				printf("Try 'chase --help' for more information.\n");
+				return 1;
+			}
+			single = single && this->placement_nodes[i] == this->chain_domain[0][0];
+		}
+		if (this->migrate_bulk && !single) {
+			printf("chase: bulk migration requires all chains in one numa domain\n");
+			printf("Try 'chase --help' for more information.\n");
+			return 1;
+		}
+	}
+
 	return 0;
 }
 
+// parse a list of nodes "n1,n2,..." or, with weights,
+// "n1=w1,n2=w2,...", where weights are at least one
+bool Experiment::parse_nodes(const char* s, bool weighted) {
+	int nodes = 1;
+	for (const char* p = s; *p != '\0'; p++) {
+		if (*p == ',')
+			nodes += 1;
+	}
+	this->num_placement_nodes = nodes;
+	this->placement_nodes = new int32[nodes];
+	this->placement_weights = new int32[nodes];
+
+	const char* p = s;
+	for (int i = 0; i < nodes; i++) {
+		char* end = NULL;
+		this->placement_nodes[i] = strtol(p, &end, 10);
+		this->placement_weights[i] = 1;
+		if (end == p || this->placement_nodes[i] < 0)
+			return false;
+		if (weighted) {
+			if (*end != '=')
+				return false;
+			p = end + 1;
+			this->placement_weights[i] = strtol(p, &end, 10);
+			if (end == p || this->placement_weights[i] < 1)
+				return false;
+		}
+		if (*end != (i + 1 < nodes ? ',' : '\0'))
+			return false;
+		p = end + 1;
+	}
+
+	return true;
+}
+
 int64 Experiment::parse_number(const char* s) {
 	int64 result = 0;
 
@@ -565,9 +2072,11 @@ float Experiment::parse_real(const char* s) {
 	return result;
 }
 
+// threads run on the nodes with cpus, in turn
 void Experiment::alloc_local() {
+	std::vector<int32> nodes = Topology::cpu_nodes(this->num_numa_domains);
 	for (int i = 0; i < this->num_threads; i++) {
-		this->thread_domain[i] = i % this->num_numa_domains;
+		this->thread_domain[i] = nodes[i % nodes.size()];
 		for (int j = 0; j < this->chains_per_thread; j++) {
 			this->chain_domain[i][j] = this->thread_domain[i];
 		}
@@ -575,8 +2084,9 @@ void Experiment::alloc_local() {
 }
 
 void Experiment::alloc_xor() {
+	std::vector<int32> nodes = Topology::cpu_nodes(this->num_numa_domains);
 	for (int i = 0; i < this->num_threads; i++) {
-		this->thread_domain[i] = i % this->num_numa_domains;
+		this->thread_domain[i] = nodes[i % nodes.size()];
 		for (int j = 0; j < this->chains_per_thread; j++) {
 			this->chain_domain[i][j] = (this->thread_domain[i]
 					^ this->offset_or_mask) % this->num_numa_domains;
@@ -585,8 +2095,9 @@ void Experiment::alloc_xor() {
 }
 
 void Experiment::alloc_add() {
+	std::vector<int32> nodes = Topology::cpu_nodes(this->num_numa_domains);
 	for (int i = 0; i < this->num_threads; i++) {
-		this->thread_domain[i] = i % this->num_numa_domains;
+		this->thread_domain[i] = nodes[i % nodes.size()];
 		for (int j = 0; j < this->chains_per_thread; j++) {
 			this->chain_domain[i][j] = (this->thread_domain[i]
 					+ this->offset_or_mask) % this->num_numa_domains;
@@ -679,8 +2190,14 @@ void Experiment::alloc_map() {
 	this->chain_domain = new int32*[this->num_threads];
 	this->random_state = new char*[this->num_threads];
 
+	std::vector<int32> nodes = Topology::cpu_nodes(this->num_numa_domains);
 	for (int i = 0; i < this->num_threads; i++) {
 		this->thread_domain[i] = thread_domain[i] % this->num_numa_domains;
+		if (std::find(nodes.begin(), nodes.end(), this->thread_domain[i]) == nodes.end()) {
+			fprintf(stderr, "Cannot run threads on numa domain %d, which has no cpus.\n",
+					this->thread_domain[i]);
+			exit(1);
+		}
 
 		const int state_size = 256;
 		this->random_state[i] = new char[state_size];
@@ -700,6 +2217,7 @@ void Experiment::alloc_map() {
 
 void Experiment::print() {
 	printf("strict            = %s\n", strict?"yes":"no");
+	printf("recalibrate       = %s\n", recalibrate?"yes":"no");
 	printf("pointer_size      = %d\n", pointer_size);
 	printf("sizeof(Chain)     = %d\n", sizeof(Chain));
 	printf("sizeof(Chain *)   = %d\n", sizeof(Chain *));
@@ -718,15 +2236,70 @@ void Experiment::print() {
 	printf("bytes_per_test    = %d\n", bytes_per_test);
 	printf("loop length       = %d\n", loop_length);
 	printf("prefetch hint     = %s\n", prefetch_hint_string(prefetch_hint));
+	printf("flush_scope       = %d\n", flush_scope);
+	printf("flush_instruction = %s\n", flush_instruction_string(flush_instruction));
+	printf("atomic_op         = %d\n", atomic_op);
+	printf("atomic_layout     = %d\n", atomic_layout);
+	printf("share_threads     = %d\n", share_threads);
+	printf("share_node        = %d\n", share_node);
+	printf("share_offset      = %d\n", share_offset);
+	printf("sibling_work      = %d\n", sibling_work);
+	printf("memory_backing    = %d\n", memory_backing);
+	printf("backing_path      = %s\n", backing_path ? backing_path : "(null)");
+	printf("populate          = %d\n", populate);
+	printf("page_faults       = %d\n", page_faults);
+	printf("fault_unbound     = %d\n", fault_unbound);
+	printf("migrate_node      = %d\n", migrate_node);
+	printf("migrate_batch     = %d\n", migrate_batch);
+	printf("migrate_bulk      = %d\n", migrate_bulk);
+	printf("migrate_chase     = %d\n", migrate_chase);
+	printf("ring_slots        = %d\n", ring_slots);
+	printf("ring_bytes        = %d\n", ring_bytes);
+	printf("ring_batch        = %d\n", ring_batch);
+	printf("num_listed_cpus   = %d\n", num_listed_cpus);
 	printf("iterations        = %d\n", iterations);
 	printf("experiments       = %d\n", experiments);
+	printf("mlp_sweep         = %d\n", mlp_sweep);
+	printf("thread_sweep      = %d\n", thread_sweep);
+	printf("page_sweep        = %d\n", page_sweep);
+	printf("way_sweep         = %d\n", way_sweep);
+	printf("monitor_interval  = %f\n", monitor_interval);
+	printf("monitor_duration  = %f\n", monitor_duration);
+	printf("duty_cycle        = %f\n", duty_cycle);
+	printf("prometheus_file   = %s\n", prometheus_file);
 	printf("access_pattern    = %d\n", access_pattern);
 	printf("stride            = %d\n", stride);
+	printf("zipf_exponent     = %f\n", zipf_exponent);
+	printf("zipf_share        = %f\n", zipf_share);
+	printf("hot_fraction      = %f\n", hot_fraction);
+	printf("hot_share         = %f\n", hot_share);
+	printf("trace_file        = %s\n", trace_file ? trace_file : "(null)");
+	printf("lines_per_visit   = %d\n", lines_per_visit);
+	printf("page_stride       = %d\n", page_stride);
+	printf("pages_per_walk    = %d\n", pages_per_walk);
+	printf("conflict_level    = %d\n", conflict_level);
+	printf("conflict_stride   = %d\n", conflict_stride);
+	printf("conflict_ways     = %d\n", conflict_ways);
+	printf("physical_mask     = 0x%llx\n", physical_mask);
+	printf("physical_value    = 0x%llx\n", physical_value);
+	printf("physical_select   = %d\n", physical_select);
+	printf("physical_pages    = %d\n", physical_pages);
+	printf("dram_class        = %d\n", dram_class);
+	printf("dram_sweep        = %d\n", dram_sweep);
+	printf("dram_bank_bits    = %d\n", dram_bank_bits);
+	printf("dram_row_mask     = 0x%llx\n", dram_row_mask);
 	printf("output_mode       = %d\n", output_mode);
 	printf("numa_placement    = %d\n", numa_placement);
 	printf("offset_or_mask    = %d\n", offset_or_mask);
+	printf("num_placement_nodes = %d\n", num_placement_nodes);
+	printf("tier_node         = %d\n", tier_node);
+	printf("tier_fraction     = %f\n", tier_fraction);
+	printf("tier_hot          = %d\n", tier_hot);
+	printf("tier_share        = %f\n", tier_share);
 	printf("numa_max_domain   = %d\n", numa_max_domain);
 	printf("num_numa_domains  = %d\n", num_numa_domains);
+	printf("save_chain        = %s\n", save_chain ? save_chain : "(null)");
+	printf("load_chain        = %s\n", load_chain ? load_chain : "(null)");
 
 	for (int i = 0; i < this->num_threads; i++) {
 		printf("%d: ", this->thread_domain[i]);
@@ -748,16 +2321,165 @@ const char* Experiment::access() {
 		result = "forward";
 	} else if (this->access_pattern == STRIDED && this->stride < 0) {
 		result = "reverse";
+	} else if (this->access_pattern == ZIPF) {
+		result = "zipf";
+	} else if (this->access_pattern == HOTCOLD) {
+		result = "hotcold";
+	} else if (this->access_pattern == TRACE) {
+		result = "trace";
+	} else if (this->access_pattern == PAGES) {
+		result = "pages";
+	} else if (this->access_pattern == CONFLICT) {
+		result = "conflict";
+	} else if (this->access_pattern == DRAM) {
+		result = "dram";
+	}
+
+	return result;
+}
+
+// number of visits of every hot line per iteration
+// of the hotcold pattern, when cold lines are
+// visited once (not limited to links per line)
+int64 Experiment::hot_visits() {
+	float cold = 1 - this->hot_fraction;
+	int64 visits = (int64) (0.5 + this->hot_share * cold
+			/ ((1 - this->hot_share) * this->hot_fraction));
+
+	return visits < 1 ? 1 : visits;
+}
+
+// threads walking the chains of the first of them,
+// all of them for shared atomic layouts by default
+int64 Experiment::sharers() {
+	if (this->share_threads < 0) {
+		return this->num_threads;
+	} else if (0 < this->share_threads) {
+		return this->share_threads;
+	} else if (this->atomic_op != NO_ATOMIC && this->atomic_layout != PADDED) {
+		return this->num_threads;
+	}
+
+	return 1;
+}
+
+const char* Experiment::flush() {
+	const char* result = NULL;
+
+	if (this->flush_scope == NO_FLUSH) {
+		result = "none";
+	} else if (this->flush_scope == LINE_FLUSH) {
+		result = "line";
+	} else if (this->flush_scope == CHAIN_FLUSH) {
+		result = "chain";
+	}
+
+	return result;
+}
+
+const char* Experiment::atomic() {
+	return atomic_op_string(this->atomic_op);
+}
+
+const char* Experiment::layout() {
+	const char* result = NULL;
+
+	if (this->atomic_layout == PADDED) {
+		result = "padded";
+	} else if (this->atomic_layout == SHARED) {
+		result = "shared";
+	} else if (this->atomic_layout == FALSE_SHARED) {
+		result = "false";
+	}
+
+	return result;
+}
+
+const char* Experiment::backing() {
+	const char* result = NULL;
+
+	if (this->memory_backing == ANON_BACKING) {
+		result = "anon";
+	} else if (this->memory_backing == SHM_BACKING) {
+		result = "shm";
+	} else if (this->memory_backing == FILE_BACKING) {
+		result = "file";
+	} else if (this->memory_backing == DAX_BACKING) {
+		result = "dax";
+	} else if (this->memory_backing == BASE_BACKING) {
+		result = "4k";
+	} else if (this->memory_backing == THP_BACKING) {
+		result = "thp";
+	} else if (this->memory_backing == HUGETLB_BACKING) {
+		result = "hugetlb";
+	}
+
+	return result;
+}
+
+const char* Experiment::faults() {
+	const char* result = NULL;
+
+	if (this->page_faults == NO_FAULTS) {
+		result = "none";
+	} else if (this->page_faults == BASE_FAULTS) {
+		result = this->fault_unbound ? "4k:unbound" : "4k";
+	} else if (this->page_faults == THP_FAULTS) {
+		result = this->fault_unbound ? "thp:unbound" : "thp";
+	} else if (this->page_faults == HUGETLB_FAULTS) {
+		result = this->fault_unbound ? "hugetlb:unbound" : "hugetlb";
 	}
 
 	return result;
 }
 
+const char* Experiment::sibling() {
+	const char* result = NULL;
+
+	if (this->sibling_work == NO_SIBLING) {
+		result = "none";
+	} else if (this->sibling_work == COMPUTE_SIBLING) {
+		result = "compute";
+	} else if (this->sibling_work == CHASE_SIBLING) {
+		result = "chase";
+	} else if (this->sibling_work == STREAM_SIBLING) {
+		result = "stream";
+	}
+
+	return result;
+}
+
+const char* Experiment::migration() {
+	const char* result = NULL;
+
+	if (this->migrate_node < 0) {
+		result = "none";
+	} else if (this->migrate_bulk) {
+		result = "migrate_pages";
+	} else {
+		result = "move_pages";
+	}
+
+	return result;
+}
+
+const char* Experiment::dram() {
+	return dram_class_string(this->dram_class);
+}
+
 const char* Experiment::placement() {
 	const char* result = NULL;
 
 	if (this->numa_placement == LOCAL) {
 		result = "local";
+	} else if (this->numa_placement == INTERLEAVE) {
+		result = "interleave";
+	} else if (this->numa_placement == WEIGHTED) {
+		result = "weighted";
+	} else if (this->numa_placement == SPLIT) {
+		result = "split";
+	} else if (this->numa_placement == TIER) {
+		result = "tier";
 	} else if (this->numa_placement == XOR) {
 		result = "xor";
 	} else if (this->numa_placement == ADD) {
@@ -20,6 +20,7 @@
 
 // Local includes
 #include "chain.h"
+#include "chainfile.h"
 #include "types.h"
 
 
@@ -35,9 +36,20 @@ public:
 	int parse_args(int argc, char* argv[]);
 	int64 parse_number(const char* s);
 	float parse_real(const char* s);
+	bool parse_nodes(const char* s, bool weighted);
 
 	const char* placement();
 	const char* access();
+	const char* flush();
+	const char* atomic();
+	const char* layout();
+	const char* backing();
+	const char* faults();
+	const char* migration();
+	const char* sibling();
+	const char* dram();
+	int64 hot_visits();
+	int64 sharers();
 
 	// fundamental parameters
     int64 pointer_size;		// number of bytes in a pointer
@@ -59,31 +71,111 @@ public:
     float seconds;			// number of seconds per experiment
     int64 iterations;		// number of iterations per experiment
     int64 experiments;		// number of experiments per test
+    int64 mlp_sweep;		// sweep chains per thread from 1 up to this limit
+    int64 thread_sweep;		// sweep threads from 1 up to this limit
+    int64 page_sweep;		// sweep pages walked from 1 up to this limit
+    int64 way_sweep;		// sweep aliasing lines from 1 up to this limit
+    float monitor_interval;	// seconds between samples of a monitor, or 0
+    float monitor_duration;	// seconds a monitor runs for, or 0 to run indefinitely
+    float duty_cycle;		// fraction of every interval a monitor runs for
+    char* prometheus_file;	// textfile a monitor exports its samples to
 
     enum { NONE, T0, T1, T2, NTA }
     prefetch_hint;			// use of prefetching
 
+    enum { NO_FLUSH, LINE_FLUSH, CHAIN_FLUSH }
+	flush_scope;			// flush visited lines, or whole chains between iterations
+    enum { CLFLUSH, CLFLUSHOPT, CLWB }
+	flush_instruction;		// instruction used to flush
+
+    enum { NO_ATOMIC, XADD, CMPXCHG, XCHG }
+	atomic_op;				// atomic read-modify-write on every visited line
+    enum { PADDED, SHARED, FALSE_SHARED }
+	atomic_layout;			// per-thread lines, one shared word, or one word per thread in shared lines
+    int64 share_threads;	// threads walking the chains of the first of them, -1 for all, or 0
+    int32 share_node;		// node of shared chains, or -1 for the domain of their first thread
+    bool share_offset;		// sharers start evenly spaced along the cycle
+    enum { NO_SIBLING, COMPUTE_SIBLING, CHASE_SIBLING, STREAM_SIBLING }
+	sibling_work;			// work of a second thread on the other smt thread of the core
+
     enum { CSV, BOTH, HEADER, TABLE }
 	output_mode;			// results output mode
 
-    enum { RANDOM, STRIDED }
+    enum { RANDOM, STRIDED, ZIPF, HOTCOLD, TRACE, PAGES, CONFLICT, DRAM }
 	access_pattern;			// memory access pattern
     int64 stride;
+    float zipf_exponent;	// skew of the zipf access pattern
+    float zipf_share;		// share of the zipf visits going to the top 1% of lines
+    float hot_fraction;		// fraction of hot lines in the hot/cold access pattern
+    float hot_share;		// share of the visits going to hot lines
+    char* trace_file;		// address trace replayed by the trace access pattern
+    int64 lines_per_visit;	// lines visited in every page by the pages access pattern
+    int64 page_stride;		// pages between visited pages, or 0 to visit pages randomly
+    int64 pages_per_walk;	// pages visited by the pages access pattern
+    int32 conflict_level;	// cache level whose sets the conflict access pattern aliases, or 0
+    int64 conflict_stride;	// bytes between the lines of the conflict access pattern
+    int64 conflict_ways;	// lines visited by the conflict access pattern
+
+    uint64 physical_mask;	// physical address bits pages are selected or grouped by, or 0
+    uint64 physical_value;	// value of the masked bits of selected pages
+    bool physical_select;	// select pages by their bits, rather than group pages by them
+    int64 physical_pages;	// pages allocated for a chain to place it physically
+
+    enum { ROW_HIT, ROW_CONFLICT, BANK_SPREAD }
+	dram_class;				// lines visited by the dram access pattern
+    bool dram_sweep;		// walk every class of the dram access pattern in turn
+    uint64* dram_banks;		// physical address bits xor'ed into every bit of a bank
+    int32 dram_bank_bits;	// number of bits of a bank
+    uint64 dram_row_mask;	// physical address bits of a row
+
+    enum { ANON_BACKING, SHM_BACKING, FILE_BACKING, DAX_BACKING,
+		BASE_BACKING, THP_BACKING, HUGETLB_BACKING }
+	memory_backing;			// heap, shared memory, page cache, dax or anonymous mapped chains
+    char* backing_path;		// directory holding the files of mapped chains
+    bool populate;			// prefault mapped chains
 
-    enum { LOCAL, XOR, ADD, MAP }
+    enum { NO_FAULTS, BASE_FAULTS, THP_FAULTS, HUGETLB_FAULTS }
+	page_faults;			// time faulting in fresh chains instead of chasing them
+    bool fault_unbound;		// fault in chains without binding them to their numa domains
+    int32 migrate_node;		// node chains migrate to and back from, or -1
+    int64 migrate_batch;	// pages moved per call of move_pages
+    bool migrate_bulk;		// migrate all pages of the process at once
+    bool migrate_chase;		// walk the chains between calls moving pages
+    int64 ring_slots;		// slots of the ring streaming messages between threads, or 0
+    int64 ring_bytes;		// bytes per slot, from a word to padded lines
+    int64 ring_batch;		// messages published and consumed at a time
+
+    enum { LOCAL, XOR, ADD, MAP, INTERLEAVE, WEIGHTED, SPLIT, TIER }
 	numa_placement;			// memory allocation mode
     int64 offset_or_mask;
     char* placement_map;
+    int32* placement_nodes;	// nodes the pages of every chain are spread over
+    int32* placement_weights;	// pages placed on every node per round of weighted placement
+    int32 num_placement_nodes;	// number of nodes pages are spread over, or 0 for all
+    int32 tier_node;		// far tier node of tiered placement
+    float tier_fraction;	// fraction of the pages of every chain on the far tier
+    bool tier_hot;			// place the most visited pages on the far tier, or the least
+    double tier_share;		// share of the visits served by the far tier, once placed
 
 	// maps threads and chains to numa domains
     int32* thread_domain;	// thread_domain[thread]
+    int32* thread_cpu;		// thread_cpu[thread], socket by socket in a thread sweep
+    int32* listed_cpus;		// cpus threads are pinned to in turn, if listed
+    int32 num_listed_cpus;	// number of listed cpus
     int32** chain_domain;	// chain_domain[thread][chain]
     int32 numa_max_domain;	// highest numa domain id
     int32 num_numa_domains;	// number of numa domains
 
     char** random_state;	// random state for each thread
 
+    char* jit_dump;			// file to dump the generated code to
+
+    char* save_chain;		// file to save the chains to
+    char* load_chain;		// file to load the chains from
+    ChainFile* chain_file;	// chains loaded from load_chain
+
     bool strict;			// strictly adhere to user input, or fail
+    bool recalibrate;		// calibrate the timer even if a calibration is cached
 
     const static int32 DEFAULT_POINTER_SIZE      = sizeof(Chain);
     const static int32 DEFAULT_BYTES_PER_LINE    = 64;
@@ -103,6 +195,7 @@ public:
     const static int32 DEFAULT_SECONDS           = 1;
     const static int32 DEFAULT_ITERATIONS        = 0;
     const static int32 DEFAULT_EXPERIMENTS       = 1;
+    const static int32 MIN_LOADS_PER_WALK        = 1000;
 
     void alloc_local();
 	void alloc_xor();
@@ -130,4 +223,42 @@ inline const char* prefetch_hint_string(int32 prefetch_hint) {
 	}
 }
 
+inline const char* flush_instruction_string(int32 flush_instruction) {
+	switch (flush_instruction) {
+	case Experiment::CLFLUSH:
+		return "clflush";
+	case Experiment::CLFLUSHOPT:
+		return "clflushopt";
+	case Experiment::CLWB:
+		return "clwb";
+	}
+	return "unknown";
+}
+
+inline const char* atomic_op_string(int32 atomic_op) {
+	switch (atomic_op) {
+	case Experiment::NO_ATOMIC:
+		return "none";
+	case Experiment::XADD:
+		return "xadd";
+	case Experiment::CMPXCHG:
+		return "cmpxchg";
+	case Experiment::XCHG:
+		return "xchg";
+	}
+	return "unknown";
+}
+
+inline const char* dram_class_string(int32 dram_class) {
+	switch (dram_class) {
+	case Experiment::ROW_HIT:
+		return "hit";
+	case Experiment::ROW_CONFLICT:
+		return "conflict";
+	case Experiment::BANK_SPREAD:
+		return "banks";
+	}
+	return "unknown";
+}
+
 #endif
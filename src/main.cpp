@@ -16,9 +16,11 @@
 
 // System includes
 #include <cstdio>
+#include <algorithm>
 
 // Local includes
 #include "run.h"
+#include "pool.h"
 #include "timer.h"
 #include "types.h"
 #include "output.h"
@@ -63,29 +65,101 @@
 int verbose = 0;
 
 int main(int argc, char* argv[]) {
-	Timer::calibrate(10000);
-	double clk_res = Timer::resolution();
-
 	Experiment e;
 	if (e.parse_args(argc, argv)) {
 		return 0;
 	}
 
-	SpinBarrier sb(e.num_threads);
-	Run r[e.num_threads];
-	for (int i = 0; i < e.num_threads; i++) {
-		r[i].set(e, &sb);
-		r[i].start();
-	}
+	Timer::calibrate(7000, !e.recalibrate);
+	double clk_res = Timer::resolution();
 
-	for (int i = 0; i < e.num_threads; i++) {
-		r[i].wait();
+	Pool* pool = new Pool(e);
+	if (0 < e.thread_sweep) {
+		// run every number of threads in turn,
+		// calibrating the iterations of each step
+		int64 limit = e.num_threads;
+		for (int64 n = 1; n <= limit; n++) {
+			e.num_threads = n;
+			e.bytes_per_test = e.bytes_per_thread * n;
+			if (n != 1 && 0 < e.seconds) {
+				e.iterations = 0;
+			}
+			pool->execute(n);
+		}
+		e.num_threads = limit;
+		e.bytes_per_test = e.bytes_per_thread * limit;
+	} else if (0 < e.page_sweep) {
+		// walk 1, 2, 4, ... pages and the limit,
+		// calibrating the iterations of each step
+		for (int64 n = 1; ; n = std::min(2 * n, e.page_sweep)) {
+			e.pages_per_walk = n;
+			if (n != 1 && 0 < e.seconds) {
+				e.iterations = 0;
+			}
+			pool->execute(e.num_threads);
+			if (n == e.page_sweep)
+				break;
+		}
+	} else if (e.dram_sweep) {
+		// walk every class of dram lines in turn,
+		// calibrating the iterations of each step
+		for (int c = Experiment::ROW_HIT; c <= Experiment::BANK_SPREAD; c++) {
+			e.dram_class = (__typeof__(e.dram_class)) c;
+			if (c != Experiment::ROW_HIT && 0 < e.seconds) {
+				e.iterations = 0;
+			}
+			pool->execute(e.num_threads);
+		}
+	} else if (0 < e.way_sweep) {
+		// walk every number of aliasing lines in turn,
+		// calibrating the iterations of each step
+		for (int64 n = 1; n <= e.way_sweep; n++) {
+			e.conflict_ways = n;
+			if (n != 1 && 0 < e.seconds) {
+				e.iterations = 0;
+			}
+			pool->execute(e.num_threads);
+		}
+	} else {
+		pool->execute(e.num_threads);
 	}
+	delete pool;
 
 	int64 ops = Run::ops_per_chain();
 	std::vector<double> seconds = Run::seconds();
 
-	Output::print(e, ops, seconds, clk_res);
+	if (0 < e.monitor_interval) {
+		// samples were streamed while running
+	} else if (0 < e.thread_sweep) {
+		Output::threads(e, ops, Run::threads(), Run::iterations(), seconds,
+				Run::thread_seconds(), clk_res);
+	} else if (0 < e.page_sweep) {
+		Output::pages(e, Run::pages(), Run::ops(), Run::iterations(),
+				seconds, clk_res);
+	} else if (e.dram_sweep) {
+		Output::dram(e, Run::dram_classes(), Run::ops(), Run::iterations(),
+				seconds, clk_res);
+	} else if (0 < e.way_sweep) {
+		Output::ways(e, Run::ways(), Run::ops(), Run::iterations(),
+				seconds, clk_res);
+	} else if (e.page_faults != Experiment::NO_FAULTS) {
+		Output::faults(e, seconds, Run::faults(), Run::fault_seconds());
+	} else if (e.sibling_work != Experiment::NO_SIBLING) {
+		Output::siblings(e, ops, Run::chains(), Run::iterations(),
+				Run::idle_seconds(), seconds, clk_res);
+	} else if (0 < e.ring_slots) {
+		Output::ring(e, seconds, Run::messages(), Run::message_seconds(),
+				Run::message_latency(), Run::message_minimum());
+	} else if (e.share_threads != 0 && e.mlp_sweep == 0) {
+		Output::sharing(e, ops, Run::iterations(), seconds, Run::thread_seconds());
+	} else if (0 <= e.migrate_node) {
+		Output::migration(e, seconds, Run::migrated(),
+				Run::migrate_seconds(), Run::pauses(), Run::latencies());
+	} else if (0 < e.mlp_sweep) {
+		Output::mlp(e, ops, Run::chains(), Run::iterations(), seconds, clk_res);
+	} else {
+		Output::print(e, ops, seconds, clk_res);
+	}
 
 	return 0;
 }
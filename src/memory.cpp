@@ -0,0 +1,322 @@
+/*******************************************************************************
+ * Copyright (c) 2006 International Business Machines Corporation.             *
+ * All rights reserved. This program and the accompanying materials            *
+ * are made available under the terms of the Common Public License v1.0        *
+ * which accompanies this distribution, and is available at                    *
+ * http://www.opensource.org/licenses/cpl1.0.php                               *
+ *                                                                             *
+ * Contributors:                                                               *
+ *    Douglas M. Pase - initial API and implementation                         *
+ *    Tim Besard - prefetching, JIT compilation                                *
+ *******************************************************************************/
+
+//
+// Configuration
+//
+
+// Implementation header
+#include "memory.h"
+
+// System includes
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#if defined(NUMA)
+#include <numa.h>
+#include <numaif.h>
+#endif
+
+
+//
+// Implementation
+//
+
+// anonymous mappings of the page fault mode or the memory backing
+// are backed by base pages, transparent huge pages or hugetlb pages
+static bool base_pages(const Experiment* exp) {
+	return exp->page_faults == Experiment::BASE_FAULTS
+			|| (exp->page_faults == Experiment::NO_FAULTS
+					&& exp->memory_backing == Experiment::BASE_BACKING);
+}
+
+static bool transparent_huge_pages(const Experiment* exp) {
+	return exp->page_faults == Experiment::THP_FAULTS
+			|| (exp->page_faults == Experiment::NO_FAULTS
+					&& exp->memory_backing == Experiment::THP_BACKING);
+}
+
+static bool hugetlb_pages(const Experiment* exp) {
+	return exp->page_faults == Experiment::HUGETLB_FAULTS
+			|| (exp->page_faults == Experiment::NO_FAULTS
+					&& exp->memory_backing == Experiment::HUGETLB_BACKING);
+}
+
+// whether chains are anonymous mappings
+static bool anonymous(const Experiment* exp) {
+	return exp->memory_backing == Experiment::BASE_BACKING
+			|| exp->memory_backing == Experiment::THP_BACKING
+			|| exp->memory_backing == Experiment::HUGETLB_BACKING;
+}
+
+// allocate the memory for a chain
+Chain* Memory::allocate(const Experiment* exp) {
+	if (exp->memory_backing == Experiment::ANON_BACKING) {
+		return new Chain[Memory::chain_bytes(exp) / sizeof(Chain)];
+	}
+	if (anonymous(exp)) {
+		return Memory::map_anonymous(exp);
+	}
+
+	int64 bytes = Memory::chain_bytes(exp);
+	char name[4096];
+	int fd;
+	if (exp->memory_backing == Experiment::SHM_BACKING) {
+		// segments are unique to the process and removed right away
+		static int segments = 0;
+		snprintf(name, sizeof(name), "/pchase-%d-%d", (int) getpid(),
+				__sync_fetch_and_add(&segments, 1));
+		fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+		if (0 <= fd)
+			shm_unlink(name);
+	} else {
+		// files are created in the directory <path>,
+		// and unlinked so they vanish with the mapping
+		snprintf(name, sizeof(name), "%s/pchase-XXXXXX", exp->backing_path);
+		fd = mkstemp(name);
+		if (0 <= fd)
+			unlink(name);
+	}
+	if (fd < 0) {
+		fprintf(stderr, "Cannot create chain memory '%s': %s.\n", name,
+				strerror(errno));
+		exit(1);
+	}
+	if (ftruncate(fd, bytes) != 0) {
+		fprintf(stderr, "Cannot size chain memory '%s': %s.\n", name,
+				strerror(errno));
+		exit(1);
+	}
+
+	Chain* memory = Memory::map(fd, bytes, exp->memory_backing,
+			exp->populate, name);
+	close(fd);
+
+	return memory;
+}
+
+// map a shared memory segment or file, requiring
+// direct access to the media for dax backing
+Chain* Memory::map(int fd, int64 bytes, int32 backing, bool populate,
+		const char* name) {
+	int flags = MAP_SHARED;
+	if (backing == Experiment::DAX_BACKING) {
+#if defined(MAP_SYNC) && defined(MAP_SHARED_VALIDATE)
+		flags = MAP_SHARED_VALIDATE | MAP_SYNC;
+#else
+		fprintf(stderr, "Cannot map '%s': dax mappings are not supported.\n", name);
+		exit(1);
+#endif
+	}
+	if (populate) {
+		flags |= MAP_POPULATE;
+	}
+
+	void* memory = mmap(NULL, bytes, PROT_READ | PROT_WRITE, flags, fd, 0);
+	if (memory == MAP_FAILED) {
+		if (backing == Experiment::DAX_BACKING && errno == EOPNOTSUPP) {
+			fprintf(stderr, "Cannot map '%s': not on a dax file system.\n", name);
+		} else {
+			fprintf(stderr, "Cannot map '%s': %s.\n", name, strerror(errno));
+		}
+		exit(1);
+	}
+
+	return (Chain*) memory;
+}
+
+// map fresh anonymous memory for a chain without
+// touching it, backed by base pages, transparent
+// huge pages or pages of the hugetlb pool
+Chain* Memory::map_anonymous(const Experiment* exp) {
+	int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+	if (hugetlb_pages(exp)) {
+		flags |= MAP_HUGETLB;
+	}
+	if (exp->populate) {
+		flags |= MAP_POPULATE;
+	}
+
+	int64 bytes = Memory::anonymous_bytes(exp);
+	void* memory = mmap(NULL, bytes, PROT_READ | PROT_WRITE, flags, -1, 0);
+	if (memory == MAP_FAILED) {
+		if (hugetlb_pages(exp)) {
+			fprintf(stderr, "Cannot map %lld bytes of hugetlb pages: %s.\n",
+					bytes, strerror(errno));
+		} else {
+			fprintf(stderr, "Cannot map %lld bytes: %s.\n", bytes,
+					strerror(errno));
+		}
+		exit(1);
+	}
+
+	// populated memory is faulted in by mmap already,
+	// so the advice only affects later faults
+	if (base_pages(exp)) {
+		madvise(memory, bytes, MADV_NOHUGEPAGE);
+	} else if (transparent_huge_pages(exp)) {
+		madvise(memory, bytes, MADV_HUGEPAGE);
+	}
+
+	return (Chain*) memory;
+}
+
+void Memory::unmap_anonymous(const Experiment* exp, Chain* memory) {
+	munmap(memory, Memory::anonymous_bytes(exp));
+}
+
+// write to every base page of the memory, in
+// address order, returning the pages written
+int64 Memory::touch(Chain* memory, int64 bytes) {
+	int64 page_size = sysconf(_SC_PAGESIZE);
+	volatile char* p = (volatile char*) memory;
+	int64 pages = 0;
+	for (int64 offset = 0; offset < bytes; offset += page_size) {
+		p[offset] = 0;
+		pages += 1;
+	}
+
+	return pages;
+}
+
+#if defined(NUMA)
+// spread the pages of a chain over several nodes, before
+// they are first touched, moving any touched already.
+// heap memory only spreads its whole pages.
+void Memory::spread(const Experiment* exp, Chain* memory) {
+	int64 page = sysconf(_SC_PAGESIZE);
+	uint64 begin = ((uint64) memory + page - 1) / page * page;
+	uint64 end = ((uint64) memory + Memory::chain_bytes(exp)) / page * page;
+	if (end <= begin)
+		return;
+
+	struct bitmask* nodes = numa_allocate_nodemask();
+	int mode = MPOL_BIND;
+	if (exp->numa_placement == Experiment::INTERLEAVE) {
+		for (int i = 0; i < exp->num_placement_nodes; i++) {
+			numa_bitmask_setbit(nodes, exp->placement_nodes[i]);
+		}
+		mode = MPOL_INTERLEAVE;
+	}
+
+	// the node of every page, binding runs of pages to their node:
+	// weighted placement deals <weight> pages to every node in turn,
+	// split placement an equal contiguous share of the chain
+	int64 pages = (end - begin) / page;
+	int64 round = 0;
+	for (int i = 0; i < exp->num_placement_nodes; i++) {
+		round += exp->placement_weights[i];
+	}
+	int64 first = 0;
+	int last = -1;
+	for (int64 p = 0; p <= pages; p++) {
+		int node = -1;
+		if (p == pages || exp->numa_placement == Experiment::INTERLEAVE) {
+			node = p == pages ? -1 : 0;
+		} else if (exp->numa_placement == Experiment::WEIGHTED) {
+			int64 slot = p % round;
+			for (node = 0; exp->placement_weights[node] <= slot; node++) {
+				slot -= exp->placement_weights[node];
+			}
+		} else {
+			node = p * exp->num_placement_nodes / pages;
+		}
+		if (node == last)
+			continue;
+
+		if (0 <= last) {
+			if (mode == MPOL_BIND) {
+				numa_bitmask_clearall(nodes);
+				numa_bitmask_setbit(nodes, exp->placement_nodes[last]);
+			}
+			if (mbind((void*) (begin + first * page), (p - first) * page, mode,
+					nodes->maskp, nodes->size + 1, MPOL_MF_MOVE) != 0) {
+				fprintf(stderr, "Cannot place chain memory: %s.\n", strerror(errno));
+				exit(1);
+			}
+		}
+		first = p;
+		last = node;
+	}
+
+	numa_free_nodemask(nodes);
+}
+
+// move whole pages to a node and keep them there
+void Memory::bind(void* begin, int64 bytes, int32 node) {
+	struct bitmask* nodes = numa_allocate_nodemask();
+	numa_bitmask_setbit(nodes, node);
+	if (mbind(begin, bytes, MPOL_BIND, nodes->maskp, nodes->size + 1,
+			MPOL_MF_MOVE) != 0) {
+		fprintf(stderr, "Cannot place chain memory: %s.\n", strerror(errno));
+		exit(1);
+	}
+	numa_free_nodemask(nodes);
+}
+#endif
+
+// chains placed by physical address select
+// their pages from a larger pool of pages
+int64 Memory::chain_bytes(const Experiment* exp) {
+	if (exp->physical_mask != 0) {
+		return exp->physical_pages * exp->bytes_per_page;
+	}
+
+	return exp->links_per_chain * sizeof(Chain);
+}
+
+// hugetlb mappings span whole huge pages
+int64 Memory::anonymous_bytes(const Experiment* exp) {
+	int64 bytes = Memory::chain_bytes(exp);
+	if (hugetlb_pages(exp)) {
+		int64 huge = Memory::huge_page_size();
+		bytes = (bytes + huge - 1) / huge * huge;
+	}
+
+	return bytes;
+}
+
+// the default huge page size, from /proc/meminfo
+int64 Memory::huge_page_size() {
+	static int64 size = 0;
+	if (size == 0) {
+		size = 2 * 1024 * 1024;
+		FILE* meminfo = fopen("/proc/meminfo", "r");
+		if (meminfo != NULL) {
+			char line[256];
+			long long kb;
+			while (fgets(line, sizeof(line), meminfo) != NULL) {
+				if (sscanf(line, "Hugepagesize: %lld kB", &kb) == 1) {
+					size = kb * 1024;
+					break;
+				}
+			}
+			fclose(meminfo);
+		}
+	}
+
+	return size;
+}
+
+void Memory::release(const Experiment* exp, Chain* memory) {
+	if (exp->memory_backing == Experiment::ANON_BACKING) {
+		delete[] memory;
+	} else if (anonymous(exp)) {
+		Memory::unmap_anonymous(exp, memory);
+	} else {
+		munmap(memory, Memory::chain_bytes(exp));
+	}
+}
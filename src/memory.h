@@ -0,0 +1,59 @@
+/*******************************************************************************
+ * Copyright (c) 2006 International Business Machines Corporation.             *
+ * All rights reserved. This program and the accompanying materials            *
+ * are made available under the terms of the Common Public License v1.0        *
+ * which accompanies this distribution, and is available at                    *
+ * http://www.opensource.org/licenses/cpl1.0.php                               *
+ *                                                                             *
+ * Contributors:                                                               *
+ *    Douglas M. Pase - initial API and implementation                         *
+ *    Tim Besard - prefetching, JIT compilation                                *
+ *******************************************************************************/
+
+//
+// Configuration
+//
+
+// Include guard
+#if !defined(MEMORY_H)
+#define MEMORY_H
+
+// Local includes
+#include "chain.h"
+#include "types.h"
+#include "experiment.h"
+
+
+//
+// Class definition
+//
+
+/*
+ * Chain memory comes from the heap, or is mapped from a shared memory segment,
+ * a regular file (backed by the page cache), a file on a DAX file system or
+ * anonymous memory of base pages, transparent huge pages or hugetlb pages.
+ * Mapped memory is created for the chain alone and removed when released.
+ */
+
+class Memory {
+public:
+	static Chain* allocate(const Experiment* exp);
+	static void release(const Experiment* exp, Chain* memory);
+
+	static Chain* map_anonymous(const Experiment* exp);
+	static void unmap_anonymous(const Experiment* exp, Chain* memory);
+	static int64 touch(Chain* memory, int64 bytes);
+	static int64 chain_bytes(const Experiment* exp);
+#if defined(NUMA)
+	static void spread(const Experiment* exp, Chain* memory);
+	static void bind(void* begin, int64 bytes, int32 node);
+#endif
+
+private:
+	static int64 anonymous_bytes(const Experiment* exp);
+	static int64 huge_page_size();
+	static Chain* map(int fd, int64 bytes, int32 backing, bool populate,
+			const char* name);
+};
+
+#endif
@@ -21,6 +21,13 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <algorithm>
+
+// Local includes
+#include "topology.h"
+#include "timer.h"
 
 
 //
@@ -45,6 +52,36 @@ void Output::print(Experiment &e, int64 ops, std::vector<double> seconds, double
 	}
 }
 
+// pages selected or grouped by physical address bits
+static const char* physical_placement(Experiment &e) {
+	static char placement[64];
+	if (e.physical_mask == 0) {
+		snprintf(placement, sizeof(placement), "none");
+	} else if (e.physical_select) {
+		snprintf(placement, sizeof(placement), "0x%llx=0x%llx",
+				e.physical_mask, e.physical_value);
+	} else {
+		snprintf(placement, sizeof(placement), "0x%llx", e.physical_mask);
+	}
+
+	return placement;
+}
+
+// nodes the pages of every chain are spread over, with weights
+static const char* placement_nodes(Experiment &e) {
+	static char nodes[256];
+	int n = snprintf(nodes, sizeof(nodes), "%s", e.num_placement_nodes == 0 ? "none" : "");
+	for (int i = 0; i < e.num_placement_nodes && n < (int) sizeof(nodes); i++) {
+		n += snprintf(nodes + n, sizeof(nodes) - n, i == 0 ? "%d" : ",%d",
+				e.placement_nodes[i]);
+		if (e.numa_placement == Experiment::WEIGHTED && n < (int) sizeof(nodes))
+			n += snprintf(nodes + n, sizeof(nodes) - n, "=%d",
+					e.placement_weights[i]);
+	}
+
+	return nodes;
+}
+
 void Output::header(Experiment &e, int64 ops, double ck_res) {
     printf("pointer size (bytes),");
     printf("cache line size (bytes),");
@@ -57,11 +94,22 @@ void Output::header(Experiment &e, int64 ops, double ck_res) {
     printf("iterations,");
     printf("loop length,");
     printf("prefetch hint,");
+    printf("flush,");
+    printf("flush instruction,");
+    printf("atomic operation,");
+    printf("atomic layout,");
+    printf("memory backing,");
+    printf("populate,");
+    printf("physical placement,");
     printf("experiments,");
     printf("access pattern,");
+    printf("skew,");
     printf("stride,");
     printf("numa placement,");
     printf("offset or mask,");
+    printf("placement nodes,");
+    printf("far tier,");
+    printf("far tier visits (%%),");
     printf("numa domains,");
     printf("domain map,");
     printf("operations per chain,");
@@ -70,7 +118,12 @@ void Output::header(Experiment &e, int64 ops, double ck_res) {
     printf("elapsed time (timer ticks),");
     printf("clock resolution (ns),", ck_res * 1E9);
     printf("memory latency (ns),");
-    printf("memory bandwidth (MB/s)\n");
+    printf("memory bandwidth (MB/s),");
+    printf("operation rate (Mops/s),");
+    printf("timer,");
+    printf("timer uncertainty (ppm),");
+    printf("core clock (GHz),");
+    printf("memory latency (cycles)\n");
 
     fflush(stdout);
 }
@@ -87,11 +140,36 @@ void Output::csv(Experiment &e, int64 ops, double secs, double ck_res) {
     printf("%ld,", e.iterations);
     printf("%ld,", e.loop_length);
     printf("%s,", prefetch_hint_string(e.prefetch_hint));
+    printf("%s,", e.flush());
+    printf("%s,", e.flush_scope == Experiment::NO_FLUSH ? "none" : flush_instruction_string(e.flush_instruction));
+    printf("%s,", e.atomic());
+    printf("%s,", e.atomic_op == Experiment::NO_ATOMIC ? "none" : e.layout());
+    if (e.backing_path != NULL) {
+        printf("%s:%s,", e.backing(), e.backing_path);
+    } else {
+        printf("%s,", e.backing());
+    }
+    printf("%s,", e.populate ? "yes" : "no");
+    printf("%s,", physical_placement(e));
     printf("%ld,", e.experiments);
     printf("%s,", e.access());
+    if (e.access_pattern == Experiment::ZIPF) {
+        printf("%g/%g,", e.zipf_exponent, e.zipf_share);
+    } else if (e.access_pattern == Experiment::HOTCOLD) {
+        printf("%g/%g,", e.hot_fraction, e.hot_share);
+    } else {
+        printf("none,");
+    }
     printf("%ld,", e.stride);
     printf("%s,", e.placement());
     printf("%ld,", e.offset_or_mask);
+    printf("\"%s\",", placement_nodes(e));
+    if (e.numa_placement == Experiment::TIER) {
+        printf("%d:%g:%s,", e.tier_node, e.tier_fraction, e.tier_hot ? "hot" : "cold");
+        printf("%.1f,", e.tier_share * 100);
+    } else {
+        printf("none,none,");
+    }
     printf("%ld,", e.num_numa_domains);
     printf("\"");
     printf("%d:", e.thread_domain[0]);
@@ -113,7 +191,12 @@ void Output::csv(Experiment &e, int64 ops, double secs, double ck_res) {
     printf("%.0f,", secs/ck_res);
     printf("%.2f,", ck_res * 1E9);
     printf("%.2f,", (secs / (ops * e.iterations)) * 1E9);
-    printf("%.3f\n", ((ops * e.iterations * e.chains_per_thread * e.num_threads * e.bytes_per_line) / secs) * 1E-6);
+    printf("%.3f,", ((ops * e.iterations * e.chains_per_thread * e.num_threads * e.bytes_per_line) / secs) * 1E-6);
+    printf("%.3f,", ((ops * e.iterations * e.chains_per_thread * e.num_threads) / secs) * 1E-6);
+    printf("%s,", Timer::source());
+    printf("%.3f,", Timer::uncertainty() * 1E6);
+    printf("%.3f,", Timer::cycles_per_second() * 1E-9);
+    printf("%.1f\n", (secs / (ops * e.iterations)) * Timer::cycles_per_second());
 
     fflush(stdout);
 }
@@ -130,11 +213,52 @@ void Output::table(Experiment &e, int64 ops, double secs, double ck_res) {
     printf("iterations           = %ld\n", e.iterations);
     printf("loop length          = %ld\n", e.loop_length);
     printf("prefetch hint        = %s\n", prefetch_hint_string(e.prefetch_hint));
+    if (e.flush_scope == Experiment::NO_FLUSH) {
+        printf("flush                = %s\n", e.flush());
+    } else {
+        printf("flush                = %s (%s)\n", e.flush(), flush_instruction_string(e.flush_instruction));
+    }
+    if (e.atomic_op == Experiment::NO_ATOMIC) {
+        printf("atomic operation     = %s\n", e.atomic());
+    } else {
+        printf("atomic operation     = %s (%s)\n", e.atomic(), e.layout());
+    }
+    if (e.backing_path != NULL) {
+        printf("memory backing       = %s:%s", e.backing(), e.backing_path);
+    } else {
+        printf("memory backing       = %s", e.backing());
+    }
+    printf("%s\n", e.populate ? " (populated)" : "");
+    if (e.physical_mask != 0) {
+        printf("physical placement   = %s (%s)\n", physical_placement(e),
+                e.physical_select ? "selected" : "grouped");
+    }
     printf("experiments          = %ld\n", e.experiments);
     printf("access pattern       = %s\n", e.access());
+    if (e.access_pattern == Experiment::ZIPF) {
+        printf("zipf exponent/share  = %g/%g\n", e.zipf_exponent, e.zipf_share);
+    } else if (e.access_pattern == Experiment::HOTCOLD) {
+        printf("hot fraction/share   = %g/%g\n", e.hot_fraction, e.hot_share);
+    } else if (e.access_pattern == Experiment::TRACE && e.trace_file != NULL) {
+        printf("trace file           = %s\n", e.trace_file);
+    }
+    if (e.load_chain != NULL) {
+        printf("chains loaded from   = %s\n", e.load_chain);
+    }
+    if (e.save_chain != NULL) {
+        printf("chains saved to      = %s\n", e.save_chain);
+    }
     printf("stride               = %ld\n", e.stride);
     printf("numa placement       = %s\n", e.placement());
     printf("offset or mask       = %ld\n", e.offset_or_mask);
+    if (0 < e.num_placement_nodes) {
+        printf("placement nodes      = %s\n", placement_nodes(e));
+    }
+    if (e.numa_placement == Experiment::TIER) {
+        printf("far tier             = %d (%g of the pages, %s)\n", e.tier_node,
+                e.tier_fraction, e.tier_hot ? "hottest" : "coldest");
+        printf("far tier visits      = %.1f (%%)\n", e.tier_share * 100);
+    }
     printf("numa domains         = %ld\n", e.num_numa_domains);
     printf("domain map           = ");
     printf("\"");
@@ -156,8 +280,1167 @@ void Output::table(Experiment &e, int64 ops, double secs, double ck_res) {
     printf("elapsed time         = %.3f (seconds)\n", secs);
     printf("elapsed time         = %.0f (timer ticks)\n", secs/ck_res);
     printf("clock resolution     = %.2f (ns)\n", ck_res * 1E9);
+    printf("timer                = %s (%.3f ppm%s)\n", Timer::source(),
+            Timer::uncertainty() * 1E6, Timer::cached() ? ", cached" : "");
+    printf("core clock           = %.3f (GHz)\n", Timer::cycles_per_second() * 1E-9);
     printf("memory latency       = %.2f (ns)\n", (secs / (ops * e.iterations)) * 1E9);
+    printf("memory latency       = %.1f (cycles)\n", (secs / (ops * e.iterations)) * Timer::cycles_per_second());
     printf("memory bandwidth     = %.3f (MB/s)\n", ((ops * e.iterations * e.chains_per_thread * e.num_threads * e.bytes_per_line) / secs) * 1E-6);
+    printf("operation rate       = %.3f (Mops/s)\n", ((ops * e.iterations * e.chains_per_thread * e.num_threads) / secs) * 1E-6);
 
     fflush(stdout);
 }
+
+// name the cache level a working set fits in,
+// per thread for private caches and for all
+// threads together for the last level cache
+static const char* cache_level(int64 bytes_per_thread, int64 bytes_per_test) {
+	long l1 = sysconf(_SC_LEVEL1_DCACHE_SIZE);
+	long l2 = sysconf(_SC_LEVEL2_CACHE_SIZE);
+	long l3 = sysconf(_SC_LEVEL3_CACHE_SIZE);
+
+	if (0 < l1 && bytes_per_thread <= l1)
+		return "L1";
+	if (0 < l2 && bytes_per_thread <= l2)
+		return "L2";
+	if (0 < l3 && bytes_per_test <= l3)
+		return "L3";
+	if (l1 <= 0 && l2 <= 0 && l3 <= 0)
+		return "unknown";
+	return "memory";
+}
+
+void Output::mlp(Experiment &e, int64 ops, std::vector<int64> chains,
+		std::vector<int64> iterations, std::vector<double> seconds, double ck_res) {
+	// average the experiments of every step
+	std::vector<int64> step_chains;
+	std::vector<int64> step_iterations;
+	std::vector<double> step_seconds;
+	std::vector<int> step_samples;
+	for (int i = 0; i < seconds.size(); i++) {
+		if (step_chains.empty() || step_chains.back() != chains[i]) {
+			step_chains.push_back(chains[i]);
+			step_iterations.push_back(iterations[i]);
+			step_seconds.push_back(0);
+			step_samples.push_back(0);
+		}
+		step_seconds.back() += seconds[i];
+		step_samples.back() += 1;
+	}
+	int steps = step_chains.size();
+	if (steps == 0)
+		return;
+
+	// latency per link, throughput per test and, by Little's law,
+	// the misses outstanding per thread: the throughput of a thread
+	// times the latency of a single chain, i.e., k * lat(1) / lat(k)
+	std::vector<double> latency(steps);
+	std::vector<double> rate(steps);
+	std::vector<double> outstanding(steps);
+	std::vector<const char*> level(steps);
+	for (int i = 0; i < steps; i++) {
+		double secs = step_seconds[i] / step_samples[i];
+		latency[i] = secs / (ops * step_iterations[i]);
+		rate[i] = (ops * step_iterations[i] * step_chains[i] * e.num_threads) / secs;
+		outstanding[i] = step_chains[i] * latency[0] / latency[i];
+		level[i] = cache_level(e.bytes_per_chain * step_chains[i],
+				e.bytes_per_chain * step_chains[i] * e.num_threads);
+	}
+
+	// the saturation point of a cache level is the first step
+	// reaching 95% of the best throughput within that level,
+	// provided later steps in the level confirm it
+	std::vector<bool> saturated(steps, false);
+	for (int i = 0; i < steps; i++) {
+		if (i != 0 && strcmp(level[i], level[i-1]) == 0)
+			continue;
+		int last = i;
+		double best = 0;
+		for (int j = i; j < steps && strcmp(level[j], level[i]) == 0; j++) {
+			best = std::max(best, rate[j]);
+			last = j;
+		}
+		for (int j = i; j < last; j++) {
+			if (0.95 * best <= rate[j]) {
+				saturated[j] = true;
+				break;
+			}
+		}
+	}
+
+	if (e.output_mode == Experiment::TABLE) {
+		printf("pointer size         = %ld (bytes)\n", e.pointer_size);
+		printf("cache line size      = %ld (bytes)\n", e.bytes_per_line);
+		printf("page size            = %ld (bytes)\n", e.bytes_per_page);
+		printf("chain size           = %ld (bytes)\n", e.bytes_per_chain);
+		printf("number of threads    = %ld\n", e.num_threads);
+		printf("loop length          = %ld\n", e.loop_length);
+		printf("prefetch hint        = %s\n", prefetch_hint_string(e.prefetch_hint));
+		printf("access pattern       = %s\n", e.access());
+		printf("numa placement       = %s\n", e.placement());
+		printf("operations per chain = %ld\n", ops);
+		printf("clock resolution     = %.2f (ns)\n", ck_res * 1E9);
+		printf("\n");
+		printf("chains  iterations  latency (ns)  bandwidth (MB/s)  rate (Mops/s)  outstanding  level\n");
+		for (int i = 0; i < steps; i++) {
+			printf("%6lld  %10lld  %12.2f  %16.3f  %13.3f  %11.2f  %-6s%s\n",
+					step_chains[i], step_iterations[i], latency[i] * 1E9,
+					rate[i] * e.bytes_per_line * 1E-6, rate[i] * 1E-6,
+					outstanding[i], level[i],
+					saturated[i] ? "  <- saturated" : "");
+		}
+	} else {
+		if (e.output_mode != Experiment::CSV) {
+			printf("chains per thread,");
+			printf("iterations,");
+			printf("cache level,");
+			printf("memory latency (ns),");
+			printf("memory bandwidth (MB/s),");
+			printf("operation rate (Mops/s),");
+			printf("outstanding misses,");
+			printf("saturated\n");
+		}
+		for (int i = 0; e.output_mode != Experiment::HEADER && i < steps; i++) {
+			printf("%lld,", step_chains[i]);
+			printf("%lld,", step_iterations[i]);
+			printf("%s,", level[i]);
+			printf("%.2f,", latency[i] * 1E9);
+			printf("%.3f,", rate[i] * e.bytes_per_line * 1E-6);
+			printf("%.3f,", rate[i] * 1E-6);
+			printf("%.2f,", outstanding[i]);
+			printf("%s\n", saturated[i] ? "yes" : "no");
+		}
+	}
+
+	fflush(stdout);
+}
+
+// bandwidth and latency of all threads and of every socket
+// for every number of threads in a sweep, and the point
+// where bandwidth saturates
+void Output::threads(Experiment &e, int64 ops, std::vector<int64> threads,
+		std::vector<int64> iterations, std::vector<double> seconds,
+		std::vector<double> thread_seconds, double ck_res) {
+	// the socket of every thread
+	std::vector<int32> socket(e.num_threads);
+	int32 sockets = 0;
+	for (int t = 0; t < e.num_threads; t++) {
+		socket[t] = Topology::socket(e.thread_cpu[t]);
+		sockets = std::max(sockets, socket[t] + 1);
+	}
+
+	// average the experiments of every step, over all
+	// threads (entry 0) and the threads of every socket
+	std::vector<int64> step_threads;
+	std::vector<int64> step_iterations;
+	std::vector<double> step_seconds;
+	std::vector<int> step_samples;
+	std::vector<std::vector<double> > step_rate;	// links per second
+	std::vector<std::vector<double> > step_latency;	// seconds per link
+	std::vector<std::vector<int> > step_members;	// threads
+	int64 offset = 0;
+	for (int i = 0; i < seconds.size(); i++) {
+		if (step_threads.empty() || step_threads.back() != threads[i]) {
+			step_threads.push_back(threads[i]);
+			step_iterations.push_back(iterations[i]);
+			step_seconds.push_back(0);
+			step_samples.push_back(0);
+			step_rate.push_back(std::vector<double>(sockets + 1, 0));
+			step_latency.push_back(std::vector<double>(sockets + 1, 0));
+			step_members.push_back(std::vector<int>(sockets + 1, 0));
+			for (int t = 0; t < threads[i]; t++) {
+				step_members.back()[0] += 1;
+				step_members.back()[socket[t] + 1] += 1;
+			}
+		}
+		step_seconds.back() += seconds[i];
+		step_samples.back() += 1;
+
+		double links = (double) ops * iterations[i];
+		for (int t = 0; t < threads[i]; t++) {
+			double secs = thread_seconds[offset + t];
+			if (secs <= 0)
+				continue;
+			step_rate.back()[socket[t] + 1] += links * e.chains_per_thread / secs;
+			step_latency.back()[0] += secs / links;
+			step_latency.back()[socket[t] + 1] += secs / links;
+		}
+		offset += threads[i];
+	}
+	int steps = step_threads.size();
+	if (steps == 0)
+		return;
+
+	// the aggregate rate is based on the elapsed time of all threads,
+	// the rate of a socket on the time of its own threads
+	std::vector<double> rate(steps);
+	for (int i = 0; i < steps; i++) {
+		double secs = step_seconds[i] / step_samples[i];
+		rate[i] = (double) ops * step_iterations[i] * e.chains_per_thread
+				* step_threads[i] / secs;
+		step_rate[i][0] = rate[i] * step_samples[i];
+	}
+
+	// saturation is the first step reaching 95% of the best
+	// bandwidth, provided later steps confirm it
+	double best = *std::max_element(rate.begin(), rate.end());
+	int saturated = -1;
+	for (int i = 0; i + 1 < steps; i++) {
+		if (0.95 * best <= rate[i]) {
+			saturated = i;
+			break;
+		}
+	}
+
+	if (e.output_mode == Experiment::TABLE) {
+		printf("pointer size         = %ld (bytes)\n", e.pointer_size);
+		printf("cache line size      = %ld (bytes)\n", e.bytes_per_line);
+		printf("page size            = %ld (bytes)\n", e.bytes_per_page);
+		printf("chain size           = %ld (bytes)\n", e.bytes_per_chain);
+		printf("chains per thread    = %ld\n", e.chains_per_thread);
+		printf("loop length          = %ld\n", e.loop_length);
+		printf("prefetch hint        = %s\n", prefetch_hint_string(e.prefetch_hint));
+		printf("access pattern       = %s\n", e.access());
+		printf("numa placement       = %s\n", e.placement());
+		if (e.share_threads < 0) {
+			printf("sharers              = all%s\n", e.share_offset ? " (offset)" : "");
+		} else if (0 < e.share_threads) {
+			printf("sharers              = %lld%s\n", e.share_threads,
+					e.share_offset ? " (offset)" : "");
+		}
+		printf("sockets              = %d\n", sockets);
+		printf("operations per chain = %ld\n", ops);
+		printf("clock resolution     = %.2f (ns)\n", ck_res * 1E9);
+		printf("\n");
+		printf("threads  socket  iterations  latency (ns)  bandwidth (MB/s)\n");
+	} else if (e.output_mode != Experiment::CSV) {
+		printf("threads,");
+		printf("socket,");
+		printf("threads on socket,");
+		printf("iterations,");
+		printf("memory latency (ns),");
+		printf("memory bandwidth (MB/s),");
+		printf("saturated\n");
+	}
+
+	for (int i = 0; e.output_mode != Experiment::HEADER && i < steps; i++) {
+		// all threads, then every socket when there are several
+		for (int s = 0; s <= sockets; s++) {
+			if (0 < s && (sockets == 1 || step_members[i][s] == 0))
+				continue;
+			double bandwidth = step_rate[i][s] / step_samples[i]
+					* e.bytes_per_line * 1E-6;
+			double latency = step_latency[i][s]
+					/ (step_samples[i] * step_members[i][s]) * 1E9;
+
+			if (e.output_mode == Experiment::TABLE) {
+				if (s == 0) {
+					printf("%7lld  %6s", step_threads[i], "all");
+				} else {
+					printf("%7lld  %6d", step_threads[i], s - 1);
+				}
+				printf("  %10lld  %12.2f  %16.3f%s\n", step_iterations[i],
+						latency, bandwidth,
+						s == 0 && i == saturated ? "  <- saturated" : "");
+			} else {
+				printf("%lld,", step_threads[i]);
+				if (s == 0) {
+					printf("all,");
+				} else {
+					printf("%d,", s - 1);
+				}
+				printf("%d,", step_members[i][s]);
+				printf("%lld,", step_iterations[i]);
+				printf("%.2f,", latency);
+				printf("%.3f,", bandwidth);
+				printf("%s\n", s == 0 && i == saturated ? "yes" : "no");
+			}
+		}
+	}
+
+	fflush(stdout);
+}
+
+// faults taken and time per fault of every thread, and
+// of all threads together, for every experiment
+void Output::faults(Experiment &e, std::vector<double> seconds,
+		std::vector<int64> faults, std::vector<double> fault_seconds) {
+	if (e.output_mode == Experiment::TABLE) {
+		printf("chain size           = %ld (bytes)\n", e.bytes_per_chain);
+		printf("chains per thread    = %ld\n", e.chains_per_thread);
+		printf("number of threads    = %ld\n", e.num_threads);
+		printf("pages                = %s%s\n", e.faults(), e.populate ? " (populated)" : "");
+		printf("numa placement       = %s\n", e.placement());
+		printf("\n");
+		printf("experiment  thread      faults   time (ms)  per fault (ns)  faults/s\n");
+	} else if (e.output_mode != Experiment::CSV) {
+		printf("pages,");
+		printf("populate,");
+		printf("chain size (bytes),");
+		printf("chains per thread,");
+		printf("number of threads,");
+		printf("experiment,");
+		printf("thread,");
+		printf("page faults,");
+		printf("elapsed time (seconds),");
+		printf("time per fault (ns),");
+		printf("faults per second\n");
+	}
+
+	for (int i = 0; e.output_mode != Experiment::HEADER && i < seconds.size(); i++) {
+		int64 total = 0;
+		for (int t = 0; t <= e.num_threads; t++) {
+			// the last row sums up all threads over the elapsed time
+			int64 count;
+			double secs;
+			if (t < e.num_threads) {
+				count = faults[i * e.num_threads + t];
+				secs = fault_seconds[i * e.num_threads + t];
+				total += count;
+			} else {
+				count = total;
+				secs = seconds[i];
+			}
+			double per_fault = 0 < count ? secs / count : 0;
+			double rate = 0 < secs ? count / secs : 0;
+
+			if (e.output_mode == Experiment::TABLE) {
+				if (t < e.num_threads) {
+					printf("%10d  %6d", i, t);
+				} else {
+					printf("%10d  %6s", i, "all");
+				}
+				printf("  %10lld  %10.3f  %14.1f  %8.0f\n", count, secs * 1E3,
+						per_fault * 1E9, rate);
+			} else {
+				printf("%s,", e.faults());
+				printf("%s,", e.populate ? "yes" : "no");
+				printf("%lld,", e.bytes_per_chain);
+				printf("%lld,", e.chains_per_thread);
+				printf("%lld,", e.num_threads);
+				printf("%d,", i);
+				if (t < e.num_threads) {
+					printf("%d,", t);
+				} else {
+					printf("all,");
+				}
+				printf("%lld,", count);
+				printf("%.6f,", secs);
+				printf("%.1f,", per_fault * 1E9);
+				printf("%.0f\n", rate);
+			}
+		}
+	}
+
+	fflush(stdout);
+}
+
+// latency and bandwidth of every thread walking shared chains,
+// averaged over the experiments in a table
+void Output::sharing(Experiment &e, int64 ops, std::vector<int64> iterations,
+		std::vector<double> seconds, std::vector<double> thread_seconds) {
+	int64 sharers = e.sharers();
+	if (e.output_mode == Experiment::TABLE) {
+		printf("chain size           = %ld (bytes)\n", e.bytes_per_chain);
+		printf("chains per thread    = %ld\n", e.chains_per_thread);
+		printf("number of threads    = %ld\n", e.num_threads);
+		printf("sharers              = %lld%s\n", sharers,
+				e.share_offset ? " (offset)" : "");
+		printf("access pattern       = %s\n", e.access());
+		printf("numa placement       = %s\n", e.placement());
+		printf("operations per chain = %ld\n", ops);
+		printf("\n");
+		printf("thread  group  node  latency (ns)  bandwidth (MB/s)\n");
+	} else if (e.output_mode != Experiment::CSV) {
+		printf("sharers,");
+		printf("offset,");
+		printf("chain size (bytes),");
+		printf("chains per thread,");
+		printf("number of threads,");
+		printf("experiment,");
+		printf("thread,");
+		printf("group,");
+		printf("chain domain,");
+		printf("memory latency (ns),");
+		printf("memory bandwidth (MB/s)\n");
+	}
+	if (e.output_mode == Experiment::HEADER || seconds.empty()) {
+		fflush(stdout);
+		return;
+	}
+
+	// the last row of the table averages all threads
+	std::vector<double> latency(e.num_threads + 1, 0);
+	std::vector<double> bandwidth(e.num_threads + 1, 0);
+	for (int i = 0; i < seconds.size(); i++) {
+		double links = (double) ops * iterations[i];
+		for (int t = 0; t < e.num_threads; t++) {
+			double secs = thread_seconds[i * e.num_threads + t];
+			double lat = 0 < links ? secs / links : 0;
+			double bw = 0 < secs
+					? links * e.chains_per_thread * e.bytes_per_line / secs : 0;
+			latency[t] += lat / seconds.size();
+			bandwidth[t] += bw / seconds.size();
+			latency[e.num_threads] += lat / (seconds.size() * e.num_threads);
+			bandwidth[e.num_threads] += bw / (seconds.size() * e.num_threads);
+
+			if (e.output_mode != Experiment::TABLE) {
+				printf("%lld,", sharers);
+				printf("%s,", e.share_offset ? "yes" : "no");
+				printf("%lld,", e.bytes_per_chain);
+				printf("%lld,", e.chains_per_thread);
+				printf("%lld,", e.num_threads);
+				printf("%d,", i);
+				printf("%d,", t);
+				printf("%lld,", t / sharers);
+				printf("%d,", e.chain_domain[t][0]);
+				printf("%.2f,", lat * 1E9);
+				printf("%.3f\n", bw * 1E-6);
+			}
+		}
+	}
+
+	for (int t = 0; e.output_mode == Experiment::TABLE && t <= e.num_threads; t++) {
+		if (t < e.num_threads) {
+			printf("%6d  %5lld  %4d", t, t / sharers, e.chain_domain[t][0]);
+		} else {
+			printf("%6s  %5s  %4s", "all", "", "");
+		}
+		printf("  %12.2f  %16.3f\n", latency[t] * 1E9, bandwidth[t] * 1E-6);
+	}
+
+	fflush(stdout);
+}
+
+// latency and rate of the chasing thread with its smt sibling
+// idle and busy, for every number of chains in an mlp sweep
+void Output::siblings(Experiment &e, int64 ops, std::vector<int64> chains,
+		std::vector<int64> iterations, std::vector<double> idle_seconds,
+		std::vector<double> seconds, double ck_res) {
+	// average the experiments of every step
+	std::vector<int64> step_chains;
+	std::vector<int64> step_iterations;
+	std::vector<double> step_idle;
+	std::vector<double> step_busy;
+	std::vector<int> step_samples;
+	for (int i = 0; i < seconds.size(); i++) {
+		if (step_chains.empty() || step_chains.back() != chains[i]) {
+			step_chains.push_back(chains[i]);
+			step_iterations.push_back(iterations[i]);
+			step_idle.push_back(0);
+			step_busy.push_back(0);
+			step_samples.push_back(0);
+		}
+		step_idle.back() += idle_seconds[i];
+		step_busy.back() += seconds[i];
+		step_samples.back() += 1;
+	}
+	int steps = step_chains.size();
+	if (steps == 0)
+		return;
+
+	// latency per link and links per second, of the
+	// chasing thread alone and next to a busy sibling
+	std::vector<double> idle_latency(steps);
+	std::vector<double> busy_latency(steps);
+	std::vector<double> idle_rate(steps);
+	std::vector<double> busy_rate(steps);
+	std::vector<double> penalty(steps);
+	for (int i = 0; i < steps; i++) {
+		double links = (double) ops * step_iterations[i];
+		double idle = step_idle[i] / step_samples[i];
+		double busy = step_busy[i] / step_samples[i];
+		idle_latency[i] = idle / links;
+		busy_latency[i] = busy / links;
+		idle_rate[i] = links * step_chains[i] / idle;
+		busy_rate[i] = links * step_chains[i] / busy;
+		penalty[i] = busy / idle - 1;
+	}
+
+	if (e.output_mode == Experiment::TABLE) {
+		printf("cache line size      = %ld (bytes)\n", e.bytes_per_line);
+		printf("page size            = %ld (bytes)\n", e.bytes_per_page);
+		printf("chain size           = %ld (bytes)\n", e.bytes_per_chain);
+		printf("access pattern       = %s\n", e.access());
+		printf("cpus                 = %d (chasing), %d (sibling)\n",
+				e.thread_cpu[0], e.thread_cpu[1]);
+		printf("sibling work         = %s\n", e.sibling());
+		printf("operations per chain = %ld\n", ops);
+		printf("clock resolution     = %.2f (ns)\n", ck_res * 1E9);
+		printf("\n");
+		printf("chains  iterations  idle (ns)  busy (ns)  idle (Mops/s)  busy (Mops/s)  penalty (%%)\n");
+		for (int i = 0; i < steps; i++) {
+			printf("%6lld  %10lld  %9.2f  %9.2f  %13.3f  %13.3f  %11.1f\n",
+					step_chains[i], step_iterations[i],
+					idle_latency[i] * 1E9, busy_latency[i] * 1E9,
+					idle_rate[i] * 1E-6, busy_rate[i] * 1E-6, penalty[i] * 100);
+		}
+	} else {
+		if (e.output_mode != Experiment::CSV) {
+			printf("sibling work,");
+			printf("chasing cpu,");
+			printf("sibling cpu,");
+			printf("chain size (bytes),");
+			printf("chains per thread,");
+			printf("iterations,");
+			printf("idle memory latency (ns),");
+			printf("busy memory latency (ns),");
+			printf("idle operation rate (Mops/s),");
+			printf("busy operation rate (Mops/s),");
+			printf("penalty (%%)\n");
+		}
+		for (int i = 0; e.output_mode != Experiment::HEADER && i < steps; i++) {
+			printf("%s,", e.sibling());
+			printf("%d,", e.thread_cpu[0]);
+			printf("%d,", e.thread_cpu[1]);
+			printf("%lld,", e.bytes_per_chain);
+			printf("%lld,", step_chains[i]);
+			printf("%lld,", step_iterations[i]);
+			printf("%.2f,", idle_latency[i] * 1E9);
+			printf("%.2f,", busy_latency[i] * 1E9);
+			printf("%.3f,", idle_rate[i] * 1E-6);
+			printf("%.3f,", busy_rate[i] * 1E-6);
+			printf("%.1f\n", penalty[i] * 100);
+		}
+	}
+
+	fflush(stdout);
+}
+
+// messages and throughput of the producer and every consumer
+// of a ring in every experiment, with the latency of the consumers
+void Output::ring(Experiment &e, std::vector<double> seconds,
+		std::vector<int64> messages, std::vector<double> message_seconds,
+		std::vector<double> latency, std::vector<double> minimum) {
+	if (e.output_mode == Experiment::TABLE) {
+		printf("ring slots           = %lld\n", e.ring_slots);
+		printf("slot size            = %lld (bytes)\n", e.ring_bytes);
+		printf("batch                = %lld\n", e.ring_batch);
+		printf("number of threads    = %ld\n", e.num_threads);
+		printf("numa placement       = %s\n", e.placement());
+		printf("\n");
+		printf("experiment  thread  role        messages   time (ms)   Mmsgs/s      MB/s"
+				"  latency (ns)  least (ns)\n");
+	} else if (e.output_mode != Experiment::CSV) {
+		printf("ring slots,");
+		printf("slot size (bytes),");
+		printf("batch,");
+		printf("number of threads,");
+		printf("experiment,");
+		printf("thread,");
+		printf("role,");
+		printf("cpu,");
+		printf("domain,");
+		printf("messages,");
+		printf("elapsed time (seconds),");
+		printf("message rate (Mmsgs/s),");
+		printf("throughput (MB/s),");
+		printf("message latency (ns),");
+		printf("least message latency (ns)\n");
+	}
+
+	for (int i = 0; e.output_mode != Experiment::HEADER && i < seconds.size(); i++) {
+		for (int t = 0; t < e.num_threads; t++) {
+			int64 sample = i * e.num_threads + t;
+			int64 count = messages[sample];
+			double secs = message_seconds[sample];
+			double rate = 0 < secs ? count / secs : 0;
+			const char* role = t == 0 ? "producer" : "consumer";
+
+			if (e.output_mode == Experiment::TABLE) {
+				printf("%10d  %6d  %-8s  %10lld  %10.3f  %8.3f  %8.1f", i, t, role,
+						count, secs * 1E3, rate * 1E-6, rate * e.ring_bytes * 1E-6);
+				if (t == 0) {
+					printf("  %12s  %10s\n", "-", "-");
+				} else {
+					printf("  %12.1f  %10.1f\n", latency[sample] * 1E9,
+							minimum[sample] * 1E9);
+				}
+			} else {
+				printf("%lld,", e.ring_slots);
+				printf("%lld,", e.ring_bytes);
+				printf("%lld,", e.ring_batch);
+				printf("%lld,", e.num_threads);
+				printf("%d,", i);
+				printf("%d,", t);
+				printf("%s,", role);
+				if (e.thread_cpu != NULL) {
+					printf("%d,", e.thread_cpu[t]);
+				} else {
+					printf("any,");
+				}
+				printf("%d,", e.thread_domain[t]);
+				printf("%lld,", count);
+				printf("%.6f,", secs);
+				printf("%.3f,", rate * 1E-6);
+				printf("%.3f,", rate * e.ring_bytes * 1E-6);
+				if (t == 0) {
+					printf("none,none\n");
+				} else {
+					printf("%.1f,", latency[sample] * 1E9);
+					printf("%.1f\n", minimum[sample] * 1E9);
+				}
+			}
+		}
+	}
+
+	fflush(stdout);
+}
+
+// pages moved, throughput and longest call of every thread in
+// every experiment, with the latency before, during and after
+void Output::migration(Experiment &e, std::vector<double> seconds,
+		std::vector<int64> migrated, std::vector<double> migrate_seconds,
+		std::vector<double> pauses, std::vector<double> latencies) {
+	int64 page_bytes = sysconf(_SC_PAGESIZE);
+	if (e.output_mode == Experiment::TABLE) {
+		printf("chain size           = %ld (bytes)\n", e.bytes_per_chain);
+		printf("chains per thread    = %ld\n", e.chains_per_thread);
+		printf("number of threads    = %ld\n", e.num_threads);
+		printf("memory backing       = %s\n", e.backing());
+		printf("page size            = %lld (bytes)\n", page_bytes);
+		if (e.migrate_bulk) {
+			printf("migration            = %s to %d\n", e.migration(), e.migrate_node);
+		} else {
+			printf("migration            = %s to %d (%lld pages per call%s)\n",
+					e.migration(), e.migrate_node, e.migrate_batch,
+					e.migrate_chase ? ", chased" : "");
+		}
+		printf("numa placement       = %s\n", e.placement());
+		printf("\n");
+		printf("experiment  thread  node     pages   time (ms)      MB/s  pause (ms)"
+				"  before (ns)  during (ns)  after (ns)\n");
+	} else if (e.output_mode != Experiment::CSV) {
+		printf("migration,");
+		printf("pages per call,");
+		printf("page size (bytes),");
+		printf("chain size (bytes),");
+		printf("chains per thread,");
+		printf("number of threads,");
+		printf("experiment,");
+		printf("thread,");
+		printf("target node,");
+		printf("pages moved,");
+		printf("elapsed time (seconds),");
+		printf("migration throughput (MB/s),");
+		printf("longest pause (seconds),");
+		printf("latency before (ns),");
+		printf("latency during (ns),");
+		printf("latency after (ns)\n");
+	}
+
+	for (int i = 0; e.output_mode != Experiment::HEADER && i < seconds.size(); i++) {
+		// even experiments move the chains away, odd ones back home
+		bool away = i % 2 == 0;
+		int64 total = 0;
+		double slowest = 0;
+		double longest = 0;
+		double latency[3] = { 0, 0, 0 };
+		for (int t = 0; t <= e.num_threads; t++) {
+			// the last row sums up all threads over the slowest of them,
+			// with their longest pause and average latencies
+			int64 sample = i * e.num_threads + t;
+			int64 pages;
+			double secs;
+			double pause;
+			double before, during, after;
+			if (t < e.num_threads) {
+				pages = migrated[sample];
+				secs = migrate_seconds[sample];
+				pause = pauses[sample];
+				before = latencies[3 * sample];
+				during = latencies[3 * sample + 1];
+				after = latencies[3 * sample + 2];
+				total += pages;
+				slowest = std::max(slowest, secs);
+				longest = std::max(longest, pause);
+				latency[0] += before / e.num_threads;
+				latency[1] += during / e.num_threads;
+				latency[2] += after / e.num_threads;
+			} else {
+				pages = total;
+				secs = slowest;
+				pause = longest;
+				before = latency[0];
+				during = latency[1];
+				after = latency[2];
+			}
+			double rate = 0 < secs ? pages * page_bytes / secs : 0;
+			int node = away ? e.migrate_node
+					: e.chain_domain[t < e.num_threads ? t : 0][0];
+
+			if (e.output_mode == Experiment::TABLE) {
+				if (t < e.num_threads) {
+					printf("%10d  %6d", i, t);
+				} else {
+					printf("%10d  %6s", i, "all");
+				}
+				printf("  %4d  %8lld  %10.3f  %8.1f  %10.3f", node, pages,
+						secs * 1E3, rate * 1E-6, pause * 1E3);
+				if (e.migrate_chase) {
+					printf("  %11.2f  %11.2f  %10.2f\n", before * 1E9,
+							during * 1E9, after * 1E9);
+				} else {
+					printf("  %11.2f  %11s  %10.2f\n", before * 1E9, "-",
+							after * 1E9);
+				}
+			} else {
+				printf("%s,", e.migration());
+				if (e.migrate_bulk) {
+					printf("all,");
+				} else {
+					printf("%lld,", e.migrate_batch);
+				}
+				printf("%lld,", page_bytes);
+				printf("%lld,", e.bytes_per_chain);
+				printf("%lld,", e.chains_per_thread);
+				printf("%lld,", e.num_threads);
+				printf("%d,", i);
+				if (t < e.num_threads) {
+					printf("%d,", t);
+				} else {
+					printf("all,");
+				}
+				printf("%d,", node);
+				printf("%lld,", pages);
+				printf("%.6f,", secs);
+				printf("%.3f,", rate * 1E-6);
+				printf("%.6f,", pause);
+				printf("%.2f,", before * 1E9);
+				if (e.migrate_chase) {
+					printf("%.2f,", during * 1E9);
+				} else {
+					printf("none,");
+				}
+				printf("%.2f\n", after * 1E9);
+			}
+		}
+	}
+
+	fflush(stdout);
+}
+
+// time per access and per page walked for every number of pages
+// in a sweep, marking the steps where the time per page jumps,
+// i.e., where the pages outgrow the reach of a level of the TLB
+void Output::pages(Experiment &e, std::vector<int64> pages,
+		std::vector<int64> ops, std::vector<int64> iterations,
+		std::vector<double> seconds, double ck_res) {
+	// average the experiments of every step
+	std::vector<int64> step_pages;
+	std::vector<int64> step_ops;
+	std::vector<int64> step_iterations;
+	std::vector<double> step_seconds;
+	std::vector<int> step_samples;
+	for (int i = 0; i < seconds.size(); i++) {
+		if (step_pages.empty() || step_pages.back() != pages[i]) {
+			step_pages.push_back(pages[i]);
+			step_ops.push_back(ops[i]);
+			step_iterations.push_back(iterations[i]);
+			step_seconds.push_back(0);
+			step_samples.push_back(0);
+		}
+		step_seconds.back() += seconds[i];
+		step_samples.back() += 1;
+	}
+	int steps = step_pages.size();
+	if (steps == 0)
+		return;
+
+	int64 stride = std::max(e.page_stride, (int64) 1);
+	std::vector<double> latency(steps);
+	std::vector<double> page_time(steps);
+	std::vector<bool> jump(steps, false);
+	for (int i = 0; i < steps; i++) {
+		double secs = step_seconds[i] / step_samples[i];
+		latency[i] = secs / (step_ops[i] * step_iterations[i]);
+		page_time[i] = latency[i] * e.lines_per_visit;
+		jump[i] = 0 < i && 1.25 * page_time[i-1] <= page_time[i];
+	}
+
+	if (e.output_mode == Experiment::TABLE) {
+		printf("pointer size         = %ld (bytes)\n", e.pointer_size);
+		printf("cache line size      = %ld (bytes)\n", e.bytes_per_line);
+		printf("page size            = %ld (bytes)\n", e.bytes_per_page);
+		printf("lines per page       = %ld\n", e.lines_per_visit);
+		printf("page stride          = %ld\n", e.page_stride);
+		printf("number of threads    = %ld\n", e.num_threads);
+		printf("access pattern       = %s\n", e.access());
+		printf("memory backing       = %s\n", e.backing());
+		printf("numa placement       = %s\n", e.placement());
+		printf("clock resolution     = %.2f (ns)\n", ck_res * 1E9);
+		printf("\n");
+		printf("   pages   span (bytes)  iterations  latency (ns)  page walk (ns)\n");
+		for (int i = 0; i < steps; i++) {
+			printf("%8lld  %13lld  %10lld  %12.2f  %14.2f%s\n",
+					step_pages[i], step_pages[i] * stride * e.bytes_per_page,
+					step_iterations[i], latency[i] * 1E9, page_time[i] * 1E9,
+					jump[i] ? "  <- jump" : "");
+		}
+	} else {
+		if (e.output_mode != Experiment::CSV) {
+			printf("pages walked,");
+			printf("span (bytes),");
+			printf("lines per page,");
+			printf("memory backing,");
+			printf("iterations,");
+			printf("memory latency (ns),");
+			printf("page walk (ns),");
+			printf("jump\n");
+		}
+		for (int i = 0; e.output_mode != Experiment::HEADER && i < steps; i++) {
+			printf("%lld,", step_pages[i]);
+			printf("%lld,", step_pages[i] * stride * e.bytes_per_page);
+			printf("%lld,", e.lines_per_visit);
+			printf("%s,", e.backing());
+			printf("%lld,", step_iterations[i]);
+			printf("%.2f,", latency[i] * 1E9);
+			printf("%.2f,", page_time[i] * 1E9);
+			printf("%s\n", jump[i] ? "yes" : "no");
+		}
+	}
+
+	fflush(stdout);
+}
+
+// latency for every number of lines aliasing to one cache set,
+// estimating the associativity as the last number of lines
+// before the latency jumps, and the cost of a conflict miss
+void Output::ways(Experiment &e, std::vector<int64> ways,
+		std::vector<int64> ops, std::vector<int64> iterations,
+		std::vector<double> seconds, double ck_res) {
+	// average the experiments of every step
+	std::vector<int64> step_ways;
+	std::vector<int64> step_ops;
+	std::vector<int64> step_iterations;
+	std::vector<double> step_seconds;
+	std::vector<int> step_samples;
+	for (int i = 0; i < seconds.size(); i++) {
+		if (step_ways.empty() || step_ways.back() != ways[i]) {
+			step_ways.push_back(ways[i]);
+			step_ops.push_back(ops[i]);
+			step_iterations.push_back(iterations[i]);
+			step_seconds.push_back(0);
+			step_samples.push_back(0);
+		}
+		step_seconds.back() += seconds[i];
+		step_samples.back() += 1;
+	}
+	int steps = step_ways.size();
+	if (steps == 0)
+		return;
+
+	std::vector<double> latency(steps);
+	for (int i = 0; i < steps; i++) {
+		double secs = step_seconds[i] / step_samples[i];
+		latency[i] = secs / (step_ops[i] * step_iterations[i]);
+	}
+
+	// the first step at least doubling the lowest latency of
+	// the steps before marks the associativity (a conflict miss
+	// costs a trip to the next level, while the other data of
+	// the program sharing the sets raises the latency slowly)
+	int jump = -1;
+	double lowest = latency[0];
+	for (int i = 1; i < steps && jump < 0; i++) {
+		if (2 * lowest <= latency[i])
+			jump = i;
+		lowest = std::min(lowest, latency[i]);
+	}
+	int64 associativity = jump < 0 ? 0 : step_ways[jump - 1];
+	double conflict = jump < 0 ? 0 : latency[steps - 1];
+
+	if (e.output_mode == Experiment::TABLE) {
+		printf("pointer size         = %ld (bytes)\n", e.pointer_size);
+		printf("cache line size      = %ld (bytes)\n", e.bytes_per_line);
+		if (0 < e.conflict_level)
+			printf("set stride           = %ld (bytes, l%d)\n", e.conflict_stride,
+					e.conflict_level);
+		else
+			printf("set stride           = %ld (bytes)\n", e.conflict_stride);
+		printf("number of threads    = %ld\n", e.num_threads);
+		printf("access pattern       = %s\n", e.access());
+		printf("memory backing       = %s\n", e.backing());
+		printf("numa placement       = %s\n", e.placement());
+		printf("clock resolution     = %.2f (ns)\n", ck_res * 1E9);
+		if (0 < associativity) {
+			printf("associativity        = %lld (ways)\n", associativity);
+			printf("conflict latency     = %.2f (ns)\n", conflict * 1E9);
+		} else {
+			printf("associativity        = beyond %lld (ways)\n", step_ways.back());
+		}
+		printf("\n");
+		printf("   lines  iterations  latency (ns)\n");
+		for (int i = 0; i < steps; i++) {
+			printf("%8lld  %10lld  %12.2f%s\n", step_ways[i], step_iterations[i],
+					latency[i] * 1E9, i == jump ? "  <- conflicts" : "");
+		}
+	} else {
+		if (e.output_mode != Experiment::CSV) {
+			printf("aliasing lines,");
+			printf("set stride (bytes),");
+			printf("memory backing,");
+			printf("iterations,");
+			printf("memory latency (ns),");
+			printf("conflicts\n");
+		}
+		for (int i = 0; e.output_mode != Experiment::HEADER && i < steps; i++) {
+			printf("%lld,", step_ways[i]);
+			printf("%lld,", e.conflict_stride);
+			printf("%s,", e.backing());
+			printf("%lld,", step_iterations[i]);
+			printf("%.2f,", latency[i] * 1E9);
+			printf("%s\n", jump != -1 && jump <= i ? "yes" : "no");
+		}
+	}
+
+	fflush(stdout);
+}
+
+// latency of row hits, row conflicts and bank switches,
+// and the penalty of a row miss over a row hit
+void Output::dram(Experiment &e, std::vector<int64> classes,
+		std::vector<int64> ops, std::vector<int64> iterations,
+		std::vector<double> seconds, double ck_res) {
+	// average the experiments of every class
+	std::vector<int64> step_classes;
+	std::vector<int64> step_ops;
+	std::vector<int64> step_iterations;
+	std::vector<double> step_seconds;
+	std::vector<int> step_samples;
+	for (int i = 0; i < seconds.size(); i++) {
+		if (step_classes.empty() || step_classes.back() != classes[i]) {
+			step_classes.push_back(classes[i]);
+			step_ops.push_back(ops[i]);
+			step_iterations.push_back(iterations[i]);
+			step_seconds.push_back(0);
+			step_samples.push_back(0);
+		}
+		step_seconds.back() += seconds[i];
+		step_samples.back() += 1;
+	}
+	int steps = step_classes.size();
+	if (steps == 0)
+		return;
+
+	std::vector<double> latency(steps);
+	std::vector<const char*> name(steps);
+	double hit = 0;
+	double conflict = 0;
+	for (int i = 0; i < steps; i++) {
+		double secs = step_seconds[i] / step_samples[i];
+		latency[i] = secs / (step_ops[i] * step_iterations[i]);
+		name[i] = dram_class_string(step_classes[i]);
+		if (step_classes[i] == Experiment::ROW_HIT)
+			hit = latency[i];
+		if (step_classes[i] == Experiment::ROW_CONFLICT)
+			conflict = latency[i];
+	}
+
+	if (e.output_mode == Experiment::TABLE) {
+		printf("pointer size         = %ld (bytes)\n", e.pointer_size);
+		printf("cache line size      = %ld (bytes)\n", e.bytes_per_line);
+		printf("chain size           = %ld (bytes)\n", e.bytes_per_chain);
+		printf("number of threads    = %ld\n", e.num_threads);
+		printf("access pattern       = %s\n", e.access());
+		printf("flush                = %s (%s)\n", e.flush(),
+				flush_instruction_string(e.flush_instruction));
+		printf("memory backing       = %s\n", e.backing());
+		printf("numa placement       = %s\n", e.placement());
+		printf("dram banks           = %lld\n", 1LL << e.dram_bank_bits);
+		printf("dram row mask        = 0x%llx\n", e.dram_row_mask);
+		printf("clock resolution     = %.2f (ns)\n", ck_res * 1E9);
+		if (0 < hit && 0 < conflict)
+			printf("row miss penalty     = %.2f (ns)\n", (conflict - hit) * 1E9);
+		printf("\n");
+		printf("class     lines  iterations  latency (ns)\n");
+		for (int i = 0; i < steps; i++) {
+			printf("%-8s  %5lld  %10lld  %12.2f\n", name[i], step_ops[i],
+					step_iterations[i], latency[i] * 1E9);
+		}
+	} else {
+		if (e.output_mode != Experiment::CSV) {
+			printf("dram class,");
+			printf("lines,");
+			printf("iterations,");
+			printf("memory latency (ns),");
+			printf("row miss penalty (ns)\n");
+		}
+		for (int i = 0; e.output_mode != Experiment::HEADER && i < steps; i++) {
+			printf("%s,", name[i]);
+			printf("%lld,", step_ops[i]);
+			printf("%lld,", step_iterations[i]);
+			printf("%.2f,", latency[i] * 1E9);
+			if (0 < hit && 0 < conflict)
+				printf("%.2f\n", (conflict - hit) * 1E9);
+			else
+				printf("none\n");
+		}
+	}
+
+	fflush(stdout);
+}
+
+// parameters and columns of the samples a monitor streams
+void Output::monitor_header(Experiment &e, int64 ops) {
+	if (e.output_mode == Experiment::TABLE) {
+		printf("pointer size         = %ld (bytes)\n", e.pointer_size);
+		printf("cache line size      = %ld (bytes)\n", e.bytes_per_line);
+		printf("page size            = %ld (bytes)\n", e.bytes_per_page);
+		printf("chain size           = %ld (bytes)\n", e.bytes_per_chain);
+		printf("chains per thread    = %ld\n", e.chains_per_thread);
+		printf("number of threads    = %ld\n", e.num_threads);
+		printf("access pattern       = %s\n", e.access());
+		printf("numa placement       = %s\n", e.placement());
+		printf("operations per chain = %ld\n", ops);
+		printf("interval             = %.3f (seconds)\n", e.monitor_interval);
+		printf("duty cycle           = %.3f\n", e.duty_cycle);
+		printf("\n");
+		printf("  time (s)  iterations  latency (ns)  bandwidth (MB/s)\n");
+	} else if (e.output_mode != Experiment::CSV) {
+		printf("time (seconds),");
+		printf("active time (seconds),");
+		printf("iterations,");
+		printf("memory latency (ns),");
+		printf("memory bandwidth (MB/s)\n");
+	}
+
+	fflush(stdout);
+}
+
+// latency of the walks of all threads in an interval, and
+// the bandwidth they consumed over its active part
+void Output::sample(Experiment &e, int64 ops, int64 chains, double time,
+		double elapsed, std::vector<double> seconds,
+		std::vector<int64> iterations) {
+	if (e.output_mode == Experiment::HEADER)
+		return;
+
+	int64 total = 0;
+	double latency = 0;
+	for (int t = 0; t < e.num_threads; t++) {
+		total += iterations[t];
+		latency += seconds[t] / (ops * iterations[t]);
+	}
+	latency /= e.num_threads;
+	double bandwidth = ops * total * chains * e.bytes_per_line / elapsed;
+
+	if (e.output_mode == Experiment::TABLE) {
+		printf("%10.3f  %10lld  %12.2f  %16.3f\n", time, total, latency * 1E9,
+				bandwidth * 1E-6);
+	} else {
+		printf("%.3f,", time);
+		printf("%.6f,", elapsed);
+		printf("%lld,", total);
+		printf("%.2f,", latency * 1E9);
+		printf("%.3f\n", bandwidth * 1E-6);
+	}
+
+	fflush(stdout);
+}
+
+// upper bounds of the latency buckets of a walk, in seconds
+static const double bucket_bound[Output::BUCKETS - 1] = {
+	1E-9, 2E-9, 5E-9, 10E-9, 20E-9, 50E-9,
+	100E-9, 200E-9, 500E-9, 1E-6, 10E-6
+};
+
+// bucket holding the average latency of a walk
+int Output::bucket(double latency) {
+	int b = 0;
+	while (b < Output::BUCKETS - 1 && bucket_bound[b] < latency)
+		b++;
+	return b;
+}
+
+// export the last sample of a monitor to a node_exporter textfile,
+// replaced atomically so the exporter never reads a partial file
+void Output::prometheus(Experiment &e, int64 ops, int64 chains,
+		double elapsed, std::vector<double> seconds,
+		std::vector<int64> iterations, std::vector<int64> walks,
+		std::vector<double> walk_seconds) {
+	char temp[4200];
+	snprintf(temp, sizeof(temp), "%s.%d", e.prometheus_file, (int) getpid());
+
+	FILE* f = fopen(temp, "w");
+	if (f == NULL) {
+		fprintf(stderr, "Cannot write prometheus textfile %s\n", temp);
+		return;
+	}
+
+	char labels[256];
+	snprintf(labels, sizeof(labels),
+			"pattern=\"%s\",chain_bytes=\"%lld\",threads=\"%lld\"",
+			e.access(), e.bytes_per_chain, e.num_threads);
+
+	// latency and bandwidth of every numa node holding
+	// chains, keyed by the node of a thread's first chain
+	std::vector<double> node_latency(e.numa_max_domain + 1, 0);
+	std::vector<double> node_bandwidth(e.numa_max_domain + 1, 0);
+	std::vector<int64> node_threads(e.numa_max_domain + 1, 0);
+	double latency = 0;
+	double bandwidth = 0;
+	for (int t = 0; t < e.num_threads; t++) {
+		int node = e.chain_domain[t][0];
+		double l = seconds[t] / (ops * iterations[t]);
+		double b = ops * iterations[t] * chains * e.bytes_per_line / elapsed;
+		latency += l;
+		bandwidth += b;
+		node_latency[node] += l;
+		node_bandwidth[node] += b;
+		node_threads[node] += 1;
+	}
+	latency /= e.num_threads;
+
+	fprintf(f, "# HELP chase_memory_latency_seconds Average latency of a dependent load in the last interval.\n");
+	fprintf(f, "# TYPE chase_memory_latency_seconds gauge\n");
+	fprintf(f, "chase_memory_latency_seconds{%s} %.6g\n", labels, latency);
+	fprintf(f, "# HELP chase_memory_bandwidth_bytes_per_second Bandwidth of all threads in the last interval.\n");
+	fprintf(f, "# TYPE chase_memory_bandwidth_bytes_per_second gauge\n");
+	fprintf(f, "chase_memory_bandwidth_bytes_per_second{%s} %.6g\n", labels,
+			bandwidth);
+
+	fprintf(f, "# HELP chase_node_memory_latency_seconds Average latency of a dependent load on a numa node in the last interval.\n");
+	fprintf(f, "# TYPE chase_node_memory_latency_seconds gauge\n");
+	for (int n = 0; n <= e.numa_max_domain; n++)
+		if (0 < node_threads[n])
+			fprintf(f, "chase_node_memory_latency_seconds{%s,node=\"%d\"} %.6g\n",
+					labels, n, node_latency[n] / node_threads[n]);
+	fprintf(f, "# HELP chase_node_memory_bandwidth_bytes_per_second Bandwidth to a numa node in the last interval.\n");
+	fprintf(f, "# TYPE chase_node_memory_bandwidth_bytes_per_second gauge\n");
+	for (int n = 0; n <= e.numa_max_domain; n++)
+		if (0 < node_threads[n])
+			fprintf(f, "chase_node_memory_bandwidth_bytes_per_second{%s,node=\"%d\"} %.6g\n",
+					labels, n, node_bandwidth[n]);
+
+	// buckets of a prometheus histogram are cumulative
+	fprintf(f, "# HELP chase_walk_latency_seconds Average latency of a dependent load in every walk of the chains.\n");
+	fprintf(f, "# TYPE chase_walk_latency_seconds histogram\n");
+	int64 count = 0;
+	for (int b = 0; b < Output::BUCKETS; b++) {
+		for (int t = 0; t < e.num_threads; t++)
+			count += walks[t * Output::BUCKETS + b];
+		if (b < Output::BUCKETS - 1)
+			fprintf(f, "chase_walk_latency_seconds_bucket{%s,le=\"%g\"} %lld\n",
+					labels, bucket_bound[b], count);
+		else
+			fprintf(f, "chase_walk_latency_seconds_bucket{%s,le=\"+Inf\"} %lld\n",
+					labels, count);
+	}
+	double sum = 0;
+	for (int t = 0; t < e.num_threads; t++)
+		sum += walk_seconds[t] / ops;
+	fprintf(f, "chase_walk_latency_seconds_sum{%s} %.6g\n", labels, sum);
+	fprintf(f, "chase_walk_latency_seconds_count{%s} %lld\n", labels, count);
+
+	fprintf(f, "# HELP chase_last_sample_timestamp_seconds Time of the last sample, to detect a stalled monitor.\n");
+	fprintf(f, "# TYPE chase_last_sample_timestamp_seconds gauge\n");
+	fprintf(f, "chase_last_sample_timestamp_seconds{%s} %lld\n", labels,
+			(int64) time(NULL));
+
+	if (fclose(f) != 0 || rename(temp, e.prometheus_file) != 0) {
+		fprintf(stderr, "Cannot replace prometheus textfile %s\n",
+				e.prometheus_file);
+		unlink(temp);
+	}
+}
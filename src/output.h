@@ -36,6 +36,43 @@ public:
 	static void header(Experiment &e, int64 ops, double ck_res);
 	static void csv(Experiment &e, int64 ops, double seconds, double ck_res);
 	static void table(Experiment &e, int64 ops, double seconds, double ck_res);
+	static void mlp(Experiment &e, int64 ops, std::vector<int64> chains,
+			std::vector<int64> iterations, std::vector<double> seconds, double ck_res);
+	static void threads(Experiment &e, int64 ops, std::vector<int64> threads,
+			std::vector<int64> iterations, std::vector<double> seconds,
+			std::vector<double> thread_seconds, double ck_res);
+	static void pages(Experiment &e, std::vector<int64> pages,
+			std::vector<int64> ops, std::vector<int64> iterations,
+			std::vector<double> seconds, double ck_res);
+	static void ways(Experiment &e, std::vector<int64> ways,
+			std::vector<int64> ops, std::vector<int64> iterations,
+			std::vector<double> seconds, double ck_res);
+	static void dram(Experiment &e, std::vector<int64> classes,
+			std::vector<int64> ops, std::vector<int64> iterations,
+			std::vector<double> seconds, double ck_res);
+	static void monitor_header(Experiment &e, int64 ops);
+	static void sample(Experiment &e, int64 ops, int64 chains, double time,
+			double elapsed, std::vector<double> seconds,
+			std::vector<int64> iterations);
+	static void prometheus(Experiment &e, int64 ops, int64 chains,
+			double elapsed, std::vector<double> seconds,
+			std::vector<int64> iterations, std::vector<int64> walks,
+			std::vector<double> walk_seconds);
+	static int bucket(double latency);
+	const static int BUCKETS = 12;		// latency buckets of a walk, the last unbounded
+	static void faults(Experiment &e, std::vector<double> seconds,
+			std::vector<int64> faults, std::vector<double> fault_seconds);
+	static void sharing(Experiment &e, int64 ops, std::vector<int64> iterations,
+			std::vector<double> seconds, std::vector<double> thread_seconds);
+	static void siblings(Experiment &e, int64 ops, std::vector<int64> chains,
+			std::vector<int64> iterations, std::vector<double> idle_seconds,
+			std::vector<double> seconds, double ck_res);
+	static void ring(Experiment &e, std::vector<double> seconds,
+			std::vector<int64> messages, std::vector<double> message_seconds,
+			std::vector<double> latency, std::vector<double> minimum);
+	static void migration(Experiment &e, std::vector<double> seconds,
+			std::vector<int64> migrated, std::vector<double> migrate_seconds,
+			std::vector<double> pauses, std::vector<double> latencies);
 private:
 };
 
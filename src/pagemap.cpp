@@ -0,0 +1,68 @@
+/*******************************************************************************
+ * Copyright (c) 2006 International Business Machines Corporation.             *
+ * All rights reserved. This program and the accompanying materials            *
+ * are made available under the terms of the Common Public License v1.0        *
+ * which accompanies this distribution, and is available at                    *
+ * http://www.opensource.org/licenses/cpl1.0.php                               *
+ *                                                                             *
+ * Contributors:                                                               *
+ *    Douglas M. Pase - initial API and implementation                         *
+ *    Tim Besard - prefetching, JIT compilation                                *
+ *******************************************************************************/
+
+//
+// Configuration
+//
+
+// Implementation header
+#include "pagemap.h"
+
+// System includes
+#include <cstdlib>
+#include <fcntl.h>
+#include <unistd.h>
+
+
+//
+// Implementation
+//
+
+// entries hold the frame number in bits 0-54
+// and whether the page is present in bit 63
+static const uint64 PAGEMAP_PRESENT = 1ULL << 63;
+static const uint64 PAGEMAP_FRAME = (1ULL << 55) - 1;
+
+int PageMap::descriptor() {
+	static int fd = -2;
+	if (fd == -2) {
+		fd = open("/proc/self/pagemap", O_RDONLY);
+	}
+
+	return fd;
+}
+
+// whether frame numbers can be read, probing
+// a page of the stack that is surely present
+bool PageMap::readable() {
+	volatile char probe = 1;
+	return PageMap::physical((const void*) &probe) != 0;
+}
+
+// the physical address of a present page,
+// or zero if it is unknown
+uint64 PageMap::physical(const void* address) {
+	int fd = PageMap::descriptor();
+	if (fd < 0)
+		return 0;
+
+	uint64 page_size = sysconf(_SC_PAGESIZE);
+	uint64 virt = (uint64) address;
+	uint64 entry = 0;
+	if (pread(fd, &entry, sizeof(entry), virt / page_size * sizeof(entry))
+			!= sizeof(entry))
+		return 0;
+	if ((entry & PAGEMAP_PRESENT) == 0 || (entry & PAGEMAP_FRAME) == 0)
+		return 0;
+
+	return (entry & PAGEMAP_FRAME) * page_size + virt % page_size;
+}
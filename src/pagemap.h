@@ -0,0 +1,43 @@
+/*******************************************************************************
+ * Copyright (c) 2006 International Business Machines Corporation.             *
+ * All rights reserved. This program and the accompanying materials            *
+ * are made available under the terms of the Common Public License v1.0        *
+ * which accompanies this distribution, and is available at                    *
+ * http://www.opensource.org/licenses/cpl1.0.php                               *
+ *                                                                             *
+ * Contributors:                                                               *
+ *    Douglas M. Pase - initial API and implementation                         *
+ *    Tim Besard - prefetching, JIT compilation                                *
+ *******************************************************************************/
+
+//
+// Configuration
+//
+
+// Include guard
+#if !defined(PAGEMAP_H)
+#define PAGEMAP_H
+
+// Local includes
+#include "types.h"
+
+
+//
+// Class definition
+//
+
+/*
+ * Physical addresses of the pages of this process, read from
+ * /proc/self/pagemap. Page frame numbers are only reported to
+ * processes with CAP_SYS_ADMIN, others read them as zero.
+ */
+
+class PageMap {
+public:
+	static bool readable();
+	static uint64 physical(const void* address);
+private:
+	static int descriptor();
+};
+
+#endif
@@ -0,0 +1,109 @@
+/*******************************************************************************
+ * Copyright (c) 2006 International Business Machines Corporation.             *
+ * All rights reserved. This program and the accompanying materials            *
+ * are made available under the terms of the Common Public License v1.0        *
+ * which accompanies this distribution, and is available at                    *
+ * http://www.opensource.org/licenses/cpl1.0.php                               *
+ *                                                                             *
+ * Contributors:                                                               *
+ *    Douglas M. Pase - initial API and implementation                         *
+ *    Tim Besard - prefetching, JIT compilation                                *
+ *******************************************************************************/
+
+//
+// Configuration
+//
+
+// Implementation header
+#include "pool.h"
+
+// Local includes
+#include "thread.h"
+
+
+//
+// Implementation
+//
+
+Pool::Pool(Experiment &e) :
+		exp(&e), workers(NULL), size(e.num_threads), bp(NULL),
+		generation(0), seen(e.num_threads, 0), active(0), pending(0),
+		stopping(false) {
+	pthread_mutex_init(&this->mutex, NULL);
+	pthread_cond_init(&this->cond, NULL);
+
+	// workers are numbered from zero,
+	// which the experiment data relies on
+	Thread::reset_ids();
+	this->workers = new Run[this->size];
+	for (int i = 0; i < this->size; i++) {
+		this->workers[i].set(this);
+		if (e.thread_cpu != NULL)
+			this->workers[i].set_cpu(e.thread_cpu[i]);
+		this->workers[i].start();
+	}
+}
+
+Pool::~Pool() {
+	pthread_mutex_lock(&this->mutex);
+	this->stopping = true;
+	pthread_cond_broadcast(&this->cond);
+	pthread_mutex_unlock(&this->mutex);
+
+	for (int i = 0; i < this->size; i++) {
+		this->workers[i].wait();
+	}
+	delete[] this->workers;
+	delete this->bp;
+
+	pthread_cond_destroy(&this->cond);
+	pthread_mutex_destroy(&this->mutex);
+}
+
+// run one step of the experiment with the
+// first <threads> workers, and wait for it
+void Pool::execute(int64 threads) {
+	pthread_mutex_lock(&this->mutex);
+	delete this->bp;
+	this->bp = new SpinBarrier(threads);
+	for (int i = 0; i < threads; i++) {
+		this->workers[i].set(*this->exp, this->bp);
+	}
+	this->active = threads;
+	this->pending = threads;
+	this->generation += 1;
+	pthread_cond_broadcast(&this->cond);
+
+	while (0 < this->pending) {
+		pthread_cond_wait(&this->cond, &this->mutex);
+	}
+	pthread_mutex_unlock(&this->mutex);
+}
+
+// wait for the next step worker <id> takes part in,
+// returning false once the pool is being destroyed
+bool Pool::next(int id) {
+	pthread_mutex_lock(&this->mutex);
+	while (!this->stopping) {
+		if (this->seen[id] != this->generation) {
+			this->seen[id] = this->generation;
+			if (id < this->active)
+				break;
+		} else {
+			pthread_cond_wait(&this->cond, &this->mutex);
+		}
+	}
+	bool result = !this->stopping;
+	pthread_mutex_unlock(&this->mutex);
+
+	return result;
+}
+
+// worker has finished the current step
+void Pool::done() {
+	pthread_mutex_lock(&this->mutex);
+	this->pending -= 1;
+	if (this->pending == 0)
+		pthread_cond_broadcast(&this->cond);
+	pthread_mutex_unlock(&this->mutex);
+}
@@ -0,0 +1,67 @@
+/*******************************************************************************
+ * Copyright (c) 2006 International Business Machines Corporation.             *
+ * All rights reserved. This program and the accompanying materials            *
+ * are made available under the terms of the Common Public License v1.0        *
+ * which accompanies this distribution, and is available at                    *
+ * http://www.opensource.org/licenses/cpl1.0.php                               *
+ *                                                                             *
+ * Contributors:                                                               *
+ *    Douglas M. Pase - initial API and implementation                         *
+ *    Tim Besard - prefetching, JIT compilation                                *
+ *******************************************************************************/
+
+//
+// Configuration
+//
+
+// Include guard
+#if !defined(POOL_H)
+#define POOL_H
+
+// System includes
+#include <pthread.h>
+#include <vector>
+
+// Local includes
+#include "run.h"
+#include "types.h"
+#include "experiment.h"
+#include "spinbarrier.h"
+
+
+//
+// Class definition
+//
+
+/*
+ * A pool starts one pinned worker per thread of the experiment once, then
+ * runs every step of a sweep with the first workers. Workers keep their
+ * chains from one step to the next, and end when the pool is destroyed.
+ */
+
+class Pool {
+public:
+	Pool(Experiment &e);
+	~Pool();
+
+	void execute(int64 threads);
+
+	bool next(int id);
+	void done();
+
+private:
+	Experiment* exp;			// experiment data
+	Run* workers;				// one worker per thread
+	int64 size;					// number of workers
+	SpinBarrier* bp;			// barrier of the current step
+
+	pthread_mutex_t mutex;
+	pthread_cond_t cond;
+	int64 generation;			// number of steps started
+	std::vector<int64> seen;	// last step seen by every worker
+	int64 active;				// workers taking part in the current step
+	int64 pending;				// workers still running the current step
+	bool stopping;				// workers are to end
+};
+
+#endif
@@ -21,99 +21,866 @@
 #include <cstdio>
 #include <cstdlib>
 #include <unistd.h>
+#include <sys/resource.h>
 #include <cstddef>
+#include <cstring>
+#include <cmath>
+#include <cctype>
+#include <cerrno>
+#include <map>
 #include <algorithm>
 #if defined(NUMA)
 #include <numa.h>
+#include <numaif.h>
 #endif
 
 // Local includes
 #include <AsmJit/AsmJit.h>
 #include "timer.h"
+#include "memory.h"
+#include "pool.h"
+#include "output.h"
+#include "pagemap.h"
 
 
 //
 // Implementation
 //
 
-typedef void (*benchmark)(const Chain**);
 typedef benchmark (*generator)(int64 chains_per_thread,
 		int64 bytes_per_line, int64 bytes_per_chain,
-		int64 stride, int64 loop_length, int32 prefetch_hint);
+		int64 stride, int64 loop_length, int32 prefetch_hint,
+		int32 flush_scope, int32 flush_instruction,
+		int32 atomic_op, int64 atomic_offset, const char* dump_file);
 static benchmark chase_pointers(int64 chains_per_thread,
 		int64 bytes_per_line, int64 bytes_per_chain,
-		int64 stride, int64 loop_length, int32 prefetch_hint);
+		int64 stride, int64 loop_length, int32 prefetch_hint,
+		int32 flush_scope, int32 flush_instruction,
+		int32 atomic_op, int64 atomic_offset, const char* dump_file);
+static void flush_chains(const Chain** root, int64 chains_per_thread,
+		int32 flush_instruction);
+static void dump_code(const char* dump_file, FILE* listing, void* code,
+		size_t size);
+static bool is_text_trace(FILE* trace);
+static bool read_address(FILE* trace, bool text, uint64* address);
 
 Lock Run::global_mutex;
 int64 Run::_ops_per_chain = 0;
 std::vector<double> Run::_seconds;
+std::vector<int64> Run::_chains;
+std::vector<int64> Run::_iterations;
+std::vector<int64> Run::_threads;
+std::vector<int64> Run::_pages;
+std::vector<int64> Run::_ways;
+std::vector<int64> Run::_dram_classes;
+std::vector<int64> Run::_ops;
+int64 Run::_tier_visits = 0;
+int64 Run::_far_visits = 0;
+std::vector<double> Run::_thread_seconds;
+std::vector<double> Run::_lap;
+std::vector<int64> Run::_lap_iterations;
+std::vector<int64> Run::_walks;
+std::vector<double> Run::_walk_seconds;
+std::vector<int64> Run::_faults;
+std::vector<double> Run::_fault_seconds;
+std::vector<int64> Run::_migrated;
+std::vector<double> Run::_migrate_seconds;
+std::vector<double> Run::_pauses;
+std::vector<double> Run::_latencies;
+std::vector<double> Run::_idle_seconds;
+volatile int64 Run::_sink = 0;
+volatile int64* Run::_ring = NULL;
+volatile int64* Run::_ring_control = NULL;
+std::vector<int64> Run::_messages;
+std::vector<double> Run::_message_seconds;
+std::vector<double> Run::_message_latency;
+std::vector<double> Run::_message_minimum;
+std::map<int64, Chain**> Run::shared_root;
+std::map<int64, std::vector<int64> > Run::_saved;
 
 Run::Run() :
-		exp(NULL), bp(NULL) {
+		exp(NULL), bp(NULL), pool(NULL), chain_memory(NULL), root(NULL) {
 }
 
 Run::~Run() {
 }
 
+// the pool hands every worker the experiment and
+// the barrier of the step it takes part in
 void Run::set(Experiment &e, SpinBarrier* sbp) {
 	this->exp = &e;
 	this->bp = sbp;
 }
 
+void Run::set(Pool* p) {
+	this->pool = p;
+}
+
 int Run::run() {
+	// workers of the pool run every step they take part in,
+	// keeping their chains from one step to the next
+	while (this->pool->next(this->thread_id())) {
+		this->step();
+		this->pool->done();
+	}
+
+	this->release();
+
+	return 0;
+}
+
+int Run::step() {
+	if (this->exp->page_faults != Experiment::NO_FAULTS) {
+		return this->fault_in();
+	}
+	if (0 < this->exp->ring_slots) {
+		return this->stream();
+	}
+
 	// first allocate all memory for the chains,
 	// making sure it is allocated within the
-	// intended numa domains
-	Chain** chain_memory = new Chain*[this->exp->chains_per_thread];
-	Chain** root = new Chain*[this->exp->chains_per_thread];
+	// intended numa domains, unless they were
+	// built in an earlier step
+	bool build = this->chain_memory == NULL;
+	if (build) {
+		this->chain_memory = new Chain*[this->exp->chains_per_thread];
+		this->root = new Chain*[this->exp->chains_per_thread];
+		for (int i = 0; i < this->exp->chains_per_thread; i++) {
+			this->chain_memory[i] = NULL;
+		}
+	}
+	Chain** chain_memory = this->chain_memory;
+	Chain** root = this->root;
+
+	// threads sharing chains walk the chains
+	// of the first thread of their group, so
+	// only that thread allocates and initializes them
+	int64 sharers = this->exp->sharers();
+	bool shared = 1 < sharers;
+	bool owner = !shared || this->thread_id() % sharers == 0;
 
 #if defined(NUMA)
 	// establish the node id where this thread
 	// will run. threads are mapped to nodes
 	// by the set-up code for Experiment.
+	// (siblings stay on the cpus of their core)
 	int run_node_id = this->exp->thread_domain[this->thread_id()];
-	numa_run_on_node(run_node_id);
+	if (this->exp->sibling_work == Experiment::NO_SIBLING)
+		numa_run_on_node(run_node_id);
 
 	// establish the node id where this thread's
 	// memory will be allocated.
-	for (int i=0; i < this->exp->chains_per_thread; i++) {
+	for (int i=0; build && owner && i < this->exp->chains_per_thread; i++) {
 		int alloc_node_id = this->exp->chain_domain[this->thread_id()][i];
 		nodemask_t alloc_mask;
 		nodemask_zero(&alloc_mask);
 		nodemask_set(&alloc_mask, alloc_node_id);
 		numa_set_membind(&alloc_mask);
 
-		chain_memory[i] = new Chain[ this->exp->links_per_chain ];
+		chain_memory[i] = Memory::allocate(this->exp);
+		if (this->exp->numa_placement == Experiment::INTERLEAVE
+				|| this->exp->numa_placement == Experiment::WEIGHTED
+				|| this->exp->numa_placement == Experiment::SPLIT)
+			Memory::spread(this->exp, chain_memory[i]);
+		if (this->exp->physical_mask != 0
+				|| this->exp->access_pattern == Experiment::DRAM)
+			Memory::touch(chain_memory[i], Memory::chain_bytes(this->exp));
 	}
 #else
-	for (int i = 0; i < this->exp->chains_per_thread; i++) {
-		chain_memory[i] = new Chain[this->exp->links_per_chain];
+	for (int i = 0; build && owner && i < this->exp->chains_per_thread; i++) {
+		chain_memory[i] = Memory::allocate(this->exp);
+		if (this->exp->physical_mask != 0
+				|| this->exp->access_pattern == Experiment::DRAM)
+			Memory::touch(chain_memory[i], Memory::chain_bytes(this->exp));
 	}
 #endif
 
 	// initialize the chains and
 	// select the function that
 	// will generate the tests
-	generator gen;
-	for (int i = 0; i < this->exp->chains_per_thread; i++) {
-		if (this->exp->access_pattern == Experiment::RANDOM) {
-			root[i] = random_mem_init(chain_memory[i]);
+	// (every step of a page, way or dram class
+	// sweep walks other lines, so it rebuilds
+	// the chains)
+	generator gen = chase_pointers;
+	bool init = build || 0 < this->exp->page_sweep
+			|| 0 < this->exp->way_sweep || this->exp->dram_sweep;
+	for (int i = 0; init && i < this->exp->chains_per_thread; i++) {
+		if (this->exp->chain_file != NULL) {
+			if (owner)
+				root[i] = loaded_mem_init(chain_memory[i], i);
+			gen = chase_pointers;
+		} else if (this->exp->access_pattern == Experiment::RANDOM) {
+			if (owner)
+				root[i] = random_mem_init(chain_memory[i]);
 			gen = chase_pointers;
 		} else if (this->exp->access_pattern == Experiment::STRIDED) {
-			if (0 < this->exp->stride) {
+			if (owner && 0 < this->exp->stride) {
 				root[i] = forward_mem_init(chain_memory[i]);
-			} else {
+			} else if (owner) {
 				root[i] = reverse_mem_init(chain_memory[i]);
 			}
 			gen = chase_pointers;
+		} else if (this->exp->access_pattern == Experiment::ZIPF
+				|| this->exp->access_pattern == Experiment::HOTCOLD) {
+			if (owner)
+				root[i] = skewed_mem_init(chain_memory[i]);
+			gen = chase_pointers;
+		} else if (this->exp->access_pattern == Experiment::TRACE) {
+			if (owner)
+				root[i] = trace_mem_init(chain_memory[i]);
+			gen = chase_pointers;
+		} else if (this->exp->access_pattern == Experiment::PAGES) {
+			if (owner)
+				root[i] = pages_mem_init(chain_memory[i]);
+			gen = chase_pointers;
+		} else if (this->exp->access_pattern == Experiment::CONFLICT) {
+			if (owner)
+				root[i] = conflict_mem_init(chain_memory[i]);
+			gen = chase_pointers;
+		} else if (this->exp->access_pattern == Experiment::DRAM) {
+			if (owner)
+				root[i] = dram_mem_init(chain_memory[i]);
+			gen = chase_pointers;
+		}
+		if (owner && this->exp->physical_mask != 0) {
+			root[i] = physical_mem_init(chain_memory[i], root[i]);
+		}
+#if defined(NUMA)
+		if (owner && this->exp->numa_placement == Experiment::TIER) {
+			far_tier(chain_memory[i], root[i]);
+		}
+#endif
+	}
+
+	if (build && this->exp->save_chain != NULL) {
+		this->save_chains(chain_memory, root, owner);
+	}
+
+	// hand the chains of the first thread of every group
+	// to the others, which may start a share of the cycle
+	// further along
+	if (shared) {
+		int64 group = this->thread_id() / sharers;
+		if (owner) {
+			Run::global_mutex.lock();
+			Run::shared_root[group] = root;
+			Run::global_mutex.unlock();
+		}
+		this->bp->barrier();
+		Run::global_mutex.lock();
+		Chain** first = Run::shared_root[group];
+		Run::global_mutex.unlock();
+		int64 skip = 0;
+		if (this->exp->share_offset) {
+			skip = this->thread_id() % sharers * Run::_ops_per_chain / sharers;
+		}
+		for (int i = 0; i < this->exp->chains_per_thread; i++) {
+			root[i] = first[i];
+			for (int64 j = 0; j < skip; j++) {
+				root[i] = root[i]->next;
+			}
+		}
+	}
+
+	// atomic operations update the word behind the link,
+	// or a word of their own in case of false sharing
+	int64 atomic_offset = this->exp->pointer_size;
+	if (this->exp->atomic_layout == Experiment::FALSE_SHARED) {
+		atomic_offset = this->exp->pointer_size
+				* (1 + this->thread_id() % (this->exp->links_per_line - 1));
+	}
+
+	// compile and measure the benchmark, once for
+	// every number of chains per thread in a sweep
+	int64 first = 0 < this->exp->mlp_sweep ? 1 : this->exp->chains_per_thread;
+	for (int64 chains = first; chains <= this->exp->chains_per_thread; chains++) {
+		// every step of a sweep calibrates its own iterations
+		if (chains != first && 0 < this->exp->seconds) {
+			this->bp->barrier();
+			if (this->thread_id() == 0)
+				this->exp->iterations = 0;
+			this->bp->barrier();
+		}
+
+		// every step of a sweep dumps its code to <file>.<chains>
+		const char* dump_file = this->thread_id() == 0 ? this->exp->jit_dump : NULL;
+		char* step_file = NULL;
+		if (dump_file != NULL && 0 < this->exp->mlp_sweep) {
+			size_t length = strlen(dump_file) + 24;
+			step_file = new char[length];
+			snprintf(step_file, length, "%s.%lld", dump_file, chains);
+			dump_file = step_file;
+		}
+
+		// compile benchmark
+		benchmark bench = gen(chains,
+				this->exp->bytes_per_line, this->exp->bytes_per_chain,
+				this->exp->stride, this->exp->loop_length,
+				this->exp->prefetch_hint, this->exp->flush_scope,
+				this->exp->flush_instruction, this->exp->atomic_op,
+				atomic_offset, dump_file);
+		delete[] step_file;
+
+		if (0 < this->exp->monitor_interval) {
+			this->monitor(bench, root, chains);
+		} else if (0 <= this->exp->migrate_node) {
+			this->migrate(bench, root, chains);
+		} else if (this->exp->sibling_work != Experiment::NO_SIBLING) {
+			this->interfere(bench, root, chains);
+		} else {
+			this->measure(bench, root, chains);
+		}
+	}
+
+	this->bp->barrier();
+
+	return 0;
+}
+
+// clean the memory
+void Run::release() {
+	for (int i = 0; this->chain_memory != NULL && i < this->exp->chains_per_thread; i++) {
+		if (this->chain_memory[i] != NULL
+			) Memory::release(this->exp, this->chain_memory[i]);
+	}
+	if (this->chain_memory != NULL
+		) delete[] this->chain_memory;
+	if (this->root != NULL
+		) delete[] this->root;
+	this->chain_memory = NULL;
+	this->root = NULL;
+}
+
+// the first thread chases its chains with the core to itself,
+// its sibling sleeping in a barrier, then again while the
+// sibling works on the other hardware thread of the core
+void Run::interfere(benchmark bench, Chain** root, int64 chains) {
+	int tid = this->thread_id();
+	static volatile int running = 0;
+
+	// calibrate the iterations of the first thread alone
+	if (this->exp->iterations == 0) {
+		this->bp->barrier();
+		if (tid == 0) {
+			double bound = std::max(0.2, 10 * Timer::resolution());
+			double elapsed = 0;
+			int64 iters = 1;
+			for (iters = 1; elapsed <= bound; iters = iters << 1) {
+				double start = Timer::seconds();
+				for (int64 i = 0; i < iters; i++)
+					bench((const Chain**) root);
+				elapsed = Timer::seconds() - start;
+			}
+			iters = iters >> 1;
+			if (0 < this->exp->seconds) {
+				this->exp->iterations = std::max(1.0,
+						0.9999 + 0.5 * this->exp->seconds * iters / elapsed);
+			} else {
+				this->exp->iterations = std::max(1.0, 0.9999 + iters / elapsed);
+			}
+		}
+	}
+	this->bp->barrier();
+
+	for (int e = 0; e < this->exp->experiments; e++) {
+		// the sibling idles
+		double idle = 0;
+		if (tid == 0) {
+			double start = Timer::seconds();
+			for (int i = 0; i < this->exp->iterations; i++)
+				bench((const Chain**) root);
+			idle = Timer::seconds() - start;
+			__atomic_store_n(&running, 1, __ATOMIC_RELEASE);
+		}
+		this->bp->barrier();
+
+		// the sibling works until the first thread is done
+		double busy = 0;
+		if (tid == 0) {
+			double start = Timer::seconds();
+			for (int i = 0; i < this->exp->iterations; i++)
+				bench((const Chain**) root);
+			busy = Timer::seconds() - start;
+			__atomic_store_n(&running, 0, __ATOMIC_RELEASE);
+		} else if (this->exp->sibling_work == Experiment::COMPUTE_SIBLING) {
+			uint64 x = tid;
+			while (__atomic_load_n(&running, __ATOMIC_ACQUIRE)) {
+				for (int i = 0; i < 1024; i++)
+					x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+			}
+			Run::_sink = x;
+		} else if (this->exp->sibling_work == Experiment::CHASE_SIBLING) {
+			while (__atomic_load_n(&running, __ATOMIC_ACQUIRE))
+				bench((const Chain**) root);
+		} else if (this->exp->sibling_work == Experiment::STREAM_SIBLING) {
+			int64 words = Memory::chain_bytes(this->exp) / sizeof(int64);
+			int64 sum = 0;
+			while (__atomic_load_n(&running, __ATOMIC_ACQUIRE)) {
+				for (int64 i = 0; i < chains; i++) {
+					const int64* memory = (const int64*) this->chain_memory[i];
+					for (int64 j = 0; j < words; j++)
+						sum += memory[j];
+				}
+			}
+			Run::_sink = sum;
+		}
+		this->bp->barrier();
+
+		if (tid == 0) {
+			Run::_idle_seconds.push_back(idle);
+			Run::_seconds.push_back(busy);
+			Run::_chains.push_back(chains);
+			Run::_iterations.push_back(this->exp->iterations);
+		}
+	}
+}
+
+// move the chains of every thread to the target node and
+// back to their domains in turn, one experiment at a time,
+// timing the moves and the walks before and after them --
+// chasing threads walk their chains after every call
+void Run::migrate(benchmark bench, Chain** root, int64 chains) {
+#if defined(NUMA)
+	int tid = this->thread_id();
+	if (tid == 0) {
+		int64 samples = this->exp->experiments * this->exp->num_threads;
+		Run::_migrated.assign(samples, 0);
+		Run::_migrate_seconds.assign(samples, 0);
+		Run::_pauses.assign(samples, 0);
+		Run::_latencies.assign(3 * samples, 0);
+	}
+
+	// every base page holding a link of the chains of this thread --
+	// move_pages moves the whole huge page of any of its base pages,
+	// wherever the mapping starts
+	int64 page = sysconf(_SC_PAGESIZE);
+	std::vector<void*> pages;
+	std::vector<int> home;
+	for (int i = 0; i < this->exp->chains_per_thread; i++) {
+		uint64 begin = (uint64) this->chain_memory[i] / page * page;
+		uint64 end = ((uint64) this->chain_memory[i]
+				+ Memory::chain_bytes(this->exp) + page - 1) / page * page;
+		for (uint64 p = begin; p < end; p += page) {
+			pages.push_back((void*) p);
+			home.push_back(this->exp->chain_domain[tid][i]);
 		}
 	}
+	int64 count = pages.size();
+	std::vector<int> nodes(count);
+	std::vector<int> status(count);
+
+	// the walks before and after a move take half the time each
+	if (this->exp->iterations == 0) {
+		this->bp->barrier();
+		double start = Timer::seconds();
+		bench((const Chain**) root);
+		double walk = Timer::seconds() - start;
+		this->bp->barrier();
+		if (tid == 0) {
+			this->exp->iterations = std::max(1.0,
+					0.9999 + 0.5 * this->exp->seconds / walk);
+		}
+	}
+	this->bp->barrier();
+	double ops = this->exp->iterations * Run::_ops_per_chain;
+
+	static double start = 0;
+	static double bulk_seconds = 0;
+	for (int e = 0; e < this->exp->experiments; e++) {
+		int64 sample = e * this->exp->num_threads + tid;
+		bool away = e % 2 == 0;
+		for (int64 i = 0; i < count; i++) {
+			nodes[i] = away ? this->exp->migrate_node : home[i];
+		}
 
-	// compile benchmark
-	benchmark bench = gen(this->exp->chains_per_thread,
-			this->exp->bytes_per_line, this->exp->bytes_per_chain,
-			this->exp->stride, this->exp->loop_length,
-			this->exp->prefetch_hint);
+		// latency before
+		this->bp->barrier();
+		double begin = Timer::seconds();
+		for (int i = 0; i < this->exp->iterations; i++)
+			bench((const Chain**) root);
+		Run::_latencies[3 * sample] = (Timer::seconds() - begin) / ops;
+
+		// move the pages
+		this->bp->barrier();
+		if (tid == 0)
+			start = Timer::seconds();
+		this->bp->barrier();
+		double moving = 0;
+		double pause = 0;
+		double walking = 0;
+		int64 walks = 0;
+		if (this->exp->migrate_bulk) {
+			if (tid == 0) {
+				struct bitmask* domains = numa_allocate_nodemask();
+				struct bitmask* target = numa_allocate_nodemask();
+				for (int t = 0; t < this->exp->num_threads; t++) {
+					for (int i = 0; i < this->exp->chains_per_thread; i++) {
+						numa_bitmask_setbit(domains, this->exp->chain_domain[t][i]);
+					}
+				}
+				numa_bitmask_setbit(target, this->exp->migrate_node);
+				double call = Timer::seconds();
+				if (numa_migrate_pages(0, away ? domains : target,
+						away ? target : domains) < 0) {
+					fprintf(stderr, "Cannot migrate chain memory: %s.\n", strerror(errno));
+					::exit(1);
+				}
+				bulk_seconds = Timer::seconds() - call;
+				numa_free_nodemask(domains);
+				numa_free_nodemask(target);
+			}
+			this->bp->barrier();
+			moving = bulk_seconds;
+			pause = bulk_seconds;
+		} else {
+			for (int64 first = 0; first < count; first += this->exp->migrate_batch) {
+				int64 batch = std::min(this->exp->migrate_batch, count - first);
+				double call = Timer::seconds();
+				if (move_pages(0, batch, &pages[first], &nodes[first],
+						&status[first], MPOL_MF_MOVE) < 0) {
+					fprintf(stderr, "Cannot migrate chain memory: %s.\n", strerror(errno));
+					::exit(1);
+				}
+				double stop = Timer::seconds();
+				moving += stop - call;
+				pause = std::max(pause, stop - call);
+				if (this->exp->migrate_chase) {
+					bench((const Chain**) root);
+					walking += Timer::seconds() - stop;
+					walks += 1;
+				}
+			}
+		}
+		this->bp->barrier();
+		if (tid == 0)
+			Run::_seconds.push_back(Timer::seconds() - start);
+
+		// latency after
+		begin = Timer::seconds();
+		for (int i = 0; i < this->exp->iterations; i++)
+			bench((const Chain**) root);
+		Run::_latencies[3 * sample + 2] = (Timer::seconds() - begin) / ops;
+
+		// the pages that reached their target
+		int64 moved = 0;
+		if (0 < count && move_pages(0, count, &pages[0], NULL, &status[0], 0) == 0) {
+			for (int64 i = 0; i < count; i++) {
+				if (status[i] == nodes[i])
+					moved += 1;
+			}
+		}
+		Run::_migrated[sample] = moved;
+		Run::_migrate_seconds[sample] = moving;
+		Run::_pauses[sample] = pause;
+		Run::_latencies[3 * sample + 1] = 0 < walks
+				? walking / (walks * Run::_ops_per_chain) : 0;
+	}
+
+	this->bp->barrier();
+#endif
+}
+
+// the control words of a ring sit a pair of lines apart,
+// out of reach of the adjacent line prefetcher
+static const int64 RING_CONTROL_STRIDE = 16;
+
+// a time stamp travels in a word of a slot
+union RingStamp {
+	double seconds;
+	int64 word;
+};
+
+// the first thread writes time-stamped messages into the ring,
+// publishing them a batch at a time, and the others read every
+// message, releasing their slots a batch at a time -- a slot is
+// reused once the slowest consumer released it
+int Run::stream() {
+	int tid = this->thread_id();
+	int64 threads = this->exp->num_threads;
+	int64 slots = this->exp->ring_slots;
+	int64 words = this->exp->ring_bytes / sizeof(int64);
+	int64 line_words = this->exp->bytes_per_line / sizeof(int64);
+	int64 batch = this->exp->ring_batch;
+
+#if defined(NUMA)
+	numa_run_on_node(this->exp->thread_domain[tid]);
+#endif
+
+	// the ring is first touched by the first thread,
+	// so it lives in that thread's domain
+	if (tid == 0) {
+		void* memory = NULL;
+		if (posix_memalign(&memory, this->exp->bytes_per_page,
+				slots * words * sizeof(int64)) != 0
+				|| posix_memalign((void**) &Run::_ring_control, this->exp->bytes_per_page,
+						(threads + 2) * RING_CONTROL_STRIDE * sizeof(int64)) != 0) {
+			fprintf(stderr, "Cannot allocate the ring.\n");
+			::exit(1);
+		}
+		Run::_ring = (volatile int64*) memory;
+		Memory::touch((Chain*) memory, slots * words * sizeof(int64));
+
+		int64 samples = this->exp->experiments * threads;
+		Run::_messages.assign(samples, 0);
+		Run::_message_seconds.assign(samples, 0);
+		Run::_message_latency.assign(samples, 0);
+		Run::_message_minimum.assign(samples, 0);
+	}
+	this->bp->barrier();
+
+	volatile int64* ring = Run::_ring;
+	volatile int64* published = Run::_ring_control;
+	volatile int64* final = Run::_ring_control + RING_CONTROL_STRIDE;
+	volatile int64* consumed = Run::_ring_control + 2 * RING_CONTROL_STRIDE;
+
+	for (int e = 0; e < this->exp->experiments; e++) {
+		if (tid == 0) {
+			*published = 0;
+			*final = -1;
+			for (int64 t = 0; t < threads; t++) {
+				consumed[t * RING_CONTROL_STRIDE] = 0;
+			}
+		}
+		this->bp->barrier();
+
+		int64 sample = e * threads + tid;
+		int64 count = 0;
+		double begin = Timer::seconds();
+		if (tid == 0) {
+			// runs for the given seconds, or iterations around the ring
+			int64 limit = 0 < this->exp->seconds ? 0 : this->exp->iterations * slots;
+			double deadline = begin + this->exp->seconds;
+			while (limit == 0 || count < limit) {
+				int64 n = limit == 0 ? batch : std::min(batch, limit - count);
+
+				// wait for the slowest consumer to release the slots
+				for (int64 t = 1; t < threads; t++) {
+					while (slots < count + n
+							- __atomic_load_n(&consumed[t * RING_CONTROL_STRIDE], __ATOMIC_ACQUIRE))
+						__asm__ __volatile__("pause");
+				}
+
+				// the sequence number goes in the first word of every
+				// line of the slot, the time stamp in the very first
+				for (int64 m = count; m < count + n; m++) {
+					volatile int64* slot = ring + m % slots * words;
+					for (int64 w = line_words; w < words; w += line_words) {
+						slot[w] = m;
+					}
+					RingStamp stamp;
+					stamp.seconds = Timer::seconds();
+					slot[0] = stamp.word;
+				}
+				count += n;
+				__atomic_store_n(published, count, __ATOMIC_RELEASE);
+
+				if (limit == 0 && deadline <= Timer::seconds())
+					break;
+			}
+			__atomic_store_n(final, count, __ATOMIC_RELEASE);
+		} else {
+			double total = 0;
+			double least = 0;
+			volatile int64* release = &consumed[tid * RING_CONTROL_STRIDE];
+			while (true) {
+				int64 available = __atomic_load_n(published, __ATOMIC_ACQUIRE);
+				if (available == count) {
+					if (__atomic_load_n(final, __ATOMIC_ACQUIRE) == count)
+						break;
+					__asm__ __volatile__("pause");
+					continue;
+				}
+
+				// read every line of a batch of messages
+				int64 end = std::min(available, count + batch);
+				for (int64 m = count; m < end; m++) {
+					volatile int64* slot = ring + m % slots * words;
+					RingStamp stamp;
+					stamp.word = slot[0];
+					for (int64 w = line_words; w < words; w += line_words) {
+						if (slot[w] != m) {
+							fprintf(stderr, "Cannot stream message %lld: its slot was reused.\n", m);
+							::exit(1);
+						}
+					}
+					double latency = Timer::seconds() - stamp.seconds;
+					total += latency;
+					if (m == 0 || latency < least)
+						least = latency;
+				}
+				count = end;
+				__atomic_store_n(release, count, __ATOMIC_RELEASE);
+			}
+			Run::_message_latency[sample] = 0 < count ? total / count : 0;
+			Run::_message_minimum[sample] = least;
+		}
+		Run::_messages[sample] = count;
+		Run::_message_seconds[sample] = Timer::seconds() - begin;
+
+		this->bp->barrier();
+		if (tid == 0) {
+			Run::_seconds.push_back(Timer::seconds() - begin);
+		}
+	}
+
+	this->bp->barrier();
+	if (tid == 0) {
+		free((void*) Run::_ring);
+		free((void*) Run::_ring_control);
+	}
+
+	return 0;
+}
+
+// time mapping and first touching fresh chains,
+// counting the page faults taken by this thread
+int Run::fault_in() {
+	int tid = this->thread_id();
+	Chain** chain_memory = new Chain*[this->exp->chains_per_thread];
+
+	if (tid == 0) {
+		int64 samples = this->exp->experiments * this->exp->num_threads;
+		Run::_faults.assign(samples, 0);
+		Run::_fault_seconds.assign(samples, 0);
+	}
+
+#if defined(NUMA)
+	numa_run_on_node(this->exp->thread_domain[tid]);
+#endif
+
+	static double start = 0;
+	for (int e = 0; e < this->exp->experiments; e++) {
+		this->bp->barrier();
+		if (tid == 0) {
+			start = Timer::seconds();
+		}
+		this->bp->barrier();
+
+		// binding is set up outside the timed window
+		struct rusage before, after;
+		getrusage(RUSAGE_THREAD, &before);
+		double elapsed = 0;
+		for (int i = 0; i < this->exp->chains_per_thread; i++) {
+#if defined(NUMA)
+			if (!this->exp->fault_unbound) {
+				nodemask_t alloc_mask;
+				nodemask_zero(&alloc_mask);
+				nodemask_set(&alloc_mask, this->exp->chain_domain[tid][i]);
+				numa_set_membind(&alloc_mask);
+			}
+#endif
+			double begin = Timer::seconds();
+			chain_memory[i] = Memory::map_anonymous(this->exp);
+			Memory::touch(chain_memory[i], this->exp->bytes_per_chain);
+			elapsed += Timer::seconds() - begin;
+		}
+		getrusage(RUSAGE_THREAD, &after);
+
+		this->bp->barrier();
+		if (tid == 0) {
+			Run::_seconds.push_back(Timer::seconds() - start);
+		}
+
+		int64 sample = e * this->exp->num_threads + tid;
+		Run::_faults[sample] = (after.ru_minflt - before.ru_minflt)
+				+ (after.ru_majflt - before.ru_majflt);
+		Run::_fault_seconds[sample] = elapsed;
+
+		for (int i = 0; i < this->exp->chains_per_thread; i++) {
+			Memory::unmap_anonymous(this->exp, chain_memory[i]);
+		}
+	}
+
+	this->bp->barrier();
+	delete[] chain_memory;
+
+	return 0;
+}
+
+// walk the chains for the duty cycle of every interval,
+// streaming the latency and bandwidth of every interval,
+// until the monitor has run for its duration
+void Run::monitor(benchmark bench, Chain** root, int64 chains) {
+	int tid = this->thread_id();
+	if (tid == 0) {
+		Run::_lap.resize(this->exp->num_threads);
+		Run::_lap_iterations.resize(this->exp->num_threads);
+		Run::_walks.assign(this->exp->num_threads * Output::BUCKETS, 0);
+		Run::_walk_seconds.assign(this->exp->num_threads, 0);
+	}
+
+	volatile static double begin = 0;
+	volatile static double start = 0;
+	volatile static bool stop = false;
+	if (tid == 0) {
+		begin = Timer::seconds();
+		stop = false;
+		Output::monitor_header(*this->exp, Run::_ops_per_chain);
+	}
+
+	double active = this->exp->monitor_interval * this->exp->duty_cycle;
+	while (!stop) {
+		// barrier
+		this->bp->barrier();
+
+		// start timer
+		if (tid == 0)
+			start = Timer::seconds();
+		this->bp->barrier();
+
+		// chase pointers for the active part of the
+		// interval, timing only the walks themselves
+		double own = 0;
+		int64 iterations = 0;
+		do {
+			if (this->exp->flush_scope == Experiment::CHAIN_FLUSH)
+				flush_chains((const Chain**) root, chains,
+						this->exp->flush_instruction);
+			double lap = Timer::seconds();
+			bench((const Chain**) root);
+			lap = Timer::seconds() - lap;
+			own += lap;
+			iterations += 1;
+			Run::_walks[tid * Output::BUCKETS
+					+ Output::bucket(lap / Run::_ops_per_chain)] += 1;
+		} while (Timer::seconds() - start < active);
+		Run::_lap[tid] = own;
+		Run::_lap_iterations[tid] = iterations;
+		Run::_walk_seconds[tid] += own;
+
+		// barrier
+		this->bp->barrier();
+
+		// report the sample
+		if (tid == 0) {
+			double now = Timer::seconds();
+			Output::sample(*this->exp, Run::_ops_per_chain, chains,
+					now - begin, now - start, Run::_lap, Run::_lap_iterations);
+			if (this->exp->prometheus_file != NULL)
+				Output::prometheus(*this->exp, Run::_ops_per_chain, chains,
+						now - start, Run::_lap, Run::_lap_iterations,
+						Run::_walks, Run::_walk_seconds);
+			if (0 < this->exp->monitor_duration
+					&& this->exp->monitor_duration <= now - begin)
+				stop = true;
+		}
+		this->bp->barrier();
+
+		// sleep for the rest of the interval
+		double rest = start + this->exp->monitor_interval - Timer::seconds();
+		if (0 < rest && !stop)
+			usleep((useconds_t) (rest * 1E6));
+	}
+}
+
+// calibrate the number of iterations if needed,
+// then time the experiments with the first
+// <chains> chains of this thread
+void Run::measure(benchmark bench, Chain** root, int64 chains) {
+	// every thread also times its own walks
+	if (this->thread_id() == 0 && Run::_lap.size() < this->exp->num_threads) {
+		Run::_lap.resize(this->exp->num_threads);
+	}
 
 	// calculate the number of iterations
 	/*
@@ -128,172 +895,835 @@ int Run::run() {
 		volatile static double elapsed = 0;
 		volatile static int64 iters = 1;
 		volatile double bound = std::max(0.2, 10 * Timer::resolution());
-		for (iters = 1; elapsed <= bound; iters = iters << 1) {
+		for (iters = 1, elapsed = 0; elapsed <= bound; iters = iters << 1) {
 			// barrier
 			this->bp->barrier();
 
-			// start timer
-			if (this->thread_id() == 0) {
-				istart = Timer::seconds();
+			// start timer
+			if (this->thread_id() == 0) {
+				istart = Timer::seconds();
+			}
+			this->bp->barrier();
+
+			// chase pointers
+			// (chain flushes are timed here, which
+			// only makes the estimate conservative)
+			for (int i = 0; i < iters; i++) {
+				if (this->exp->flush_scope == Experiment::CHAIN_FLUSH)
+					flush_chains((const Chain**) root,
+							chains,
+							this->exp->flush_instruction);
+				bench((const Chain**) root);
+			}
+
+			// barrier
+			this->bp->barrier();
+
+			// stop timer
+			if (this->thread_id() == 0) {
+				istop = Timer::seconds();
+				elapsed = istop - istart;
+			}
+			this->bp->barrier();
+		}
+
+		// calculate the number of iterations
+		if (this->thread_id() == 0) {
+			if (0 < this->exp->seconds) {
+				this->exp->iterations = std::max(1.0,
+						0.9999 + 0.5 * this->exp->seconds * iters / elapsed);
+			} else {
+				this->exp->iterations = std::max(1.0, 0.9999 + iters / elapsed);
+			}
+			//printf("Tested %d iterations: took %f seconds; scheduling %d iterations\n", iters, elapsed, this->exp->iterations);
+		}
+		this->bp->barrier();
+	}
+
+	// run the experiments
+	for (int e = 0; e < this->exp->experiments; e++) {
+		double start = 0;
+		double stop = 0;
+		double own = 0;
+		if (this->exp->flush_scope == Experiment::CHAIN_FLUSH) {
+			// flush the chains before every iteration,
+			// and only time the walks themselves
+			// (start stays zero, stop accumulates)
+			for (int i = 0; i < this->exp->iterations; i++) {
+				flush_chains((const Chain**) root,
+						chains,
+						this->exp->flush_instruction);
+
+				// barrier
+				this->bp->barrier();
+
+				// start timer
+				double lap = 0;
+				if (this->thread_id() == 0)
+					lap = Timer::seconds();
+				this->bp->barrier();
+
+				// chase pointers
+				double own_lap = Timer::seconds();
+				bench((const Chain**) root);
+				own += Timer::seconds() - own_lap;
+
+				// barrier
+				this->bp->barrier();
+
+				// stop timer
+				if (this->thread_id() == 0)
+					stop += Timer::seconds() - lap;
+			}
+			this->bp->barrier();
+		} else {
+			// barrier
+			this->bp->barrier();
+
+			// start timer
+			if (this->thread_id() == 0)
+				start = Timer::seconds();
+			this->bp->barrier();
+
+			// chase pointers
+			double own_start = Timer::seconds();
+			for (int i = 0; i < this->exp->iterations; i++)
+				bench((const Chain**) root);
+			own = Timer::seconds() - own_start;
+
+			// barrier
+			this->bp->barrier();
+
+			// stop timer
+			if (this->thread_id() == 0)
+				stop = Timer::seconds();
+			this->bp->barrier();
+		}
+
+		Run::_lap[this->thread_id()] = own;
+		this->bp->barrier();
+
+		if (0 <= e) {
+			if (this->thread_id() == 0) {
+				double delta = stop - start;
+				if (0 < delta) {
+					Run::_seconds.push_back(delta);
+					Run::_chains.push_back(chains);
+					Run::_iterations.push_back(this->exp->iterations);
+					Run::_threads.push_back(this->exp->num_threads);
+					Run::_pages.push_back(this->exp->pages_per_walk);
+					Run::_ways.push_back(this->exp->conflict_ways);
+					Run::_dram_classes.push_back(this->exp->dram_class);
+					Run::_ops.push_back(Run::_ops_per_chain);
+					Run::_thread_seconds.insert(Run::_thread_seconds.end(),
+							Run::_lap.begin(),
+							Run::_lap.begin() + this->exp->num_threads);
+				}
+			}
+		}
+	}
+}
+
+int dummy = 0;
+void Run::mem_check(Chain *m) {
+	if (m == NULL
+		) dummy += 1;
+}
+
+// exclude 2 and Mersenne primes, i.e.,
+// primes of the form 2**n - 1, e.g.,
+// 3, 7, 31, 127
+static const int prime_table[] = { 5, 11, 13, 17, 19, 23, 37, 41, 43, 47, 53,
+		61, 71, 73, 79, 83, 89, 97, 101, 103, 109, 113, 131, 137, 139, 149, 151,
+		157, 163, };
+static const int prime_table_size = sizeof prime_table / sizeof prime_table[0];
+
+Chain*
+Run::random_mem_init(Chain *mem) {
+	// initialize pointers --
+	// choose a page at random, then use
+	// one pointer from each cache line
+	// within the page.  all pages and
+	// cache lines are chosen at random.
+	Chain* root = 0;
+	Chain* prev = 0;
+	int link_within_line = 0;
+	int64 local_ops_per_chain = 0;
+
+	// we must set a lock because random()
+	// is not thread safe
+	Run::global_mutex.lock();
+	setstate(this->exp->random_state[this->thread_id()]);
+	int page_factor = prime_table[random() % prime_table_size];
+	int page_offset = random() % this->exp->pages_per_chain;
+	Run::global_mutex.unlock();
+
+	// loop through the pages
+	for (int i = 0; i < this->exp->pages_per_chain; i++) {
+		int page = (page_factor * i + page_offset) % this->exp->pages_per_chain;
+		Run::global_mutex.lock();
+		setstate(this->exp->random_state[this->thread_id()]);
+		int line_factor = prime_table[random() % prime_table_size];
+		int line_offset = random() % this->exp->lines_per_page;
+		Run::global_mutex.unlock();
+
+		// loop through the lines within a page
+		for (int j = 0; j < this->exp->lines_per_page; j++) {
+			int line_within_page = (line_factor * j + line_offset)
+					% this->exp->lines_per_page;
+			int link = page * this->exp->links_per_page
+					+ line_within_page * this->exp->links_per_line
+					+ link_within_line;
+
+			if (root == 0) {
+				prev = root = mem + link;
+				local_ops_per_chain += 1;
+			} else {
+				prev->next = mem + link;
+				prev = prev->next;
+				local_ops_per_chain += 1;
+			}
+		}
+	}
+
+	prev->next = root;
+
+	Run::global_mutex.lock();
+	Run::_ops_per_chain = local_ops_per_chain;
+	Run::global_mutex.unlock();
+
+	return root;
+}
+
+Chain*
+Run::forward_mem_init(Chain *mem) {
+	Chain* root = 0;
+	Chain* prev = 0;
+	int link_within_line = 0;
+	int64 local_ops_per_chain = 0;
+
+	for (int i = 0; i < this->exp->lines_per_chain; i += this->exp->stride) {
+		int link = i * this->exp->links_per_line + link_within_line;
+		if (root == NULL) {
+			prev = root = mem + link;
+			local_ops_per_chain += 1;
+		} else {
+			prev->next = mem + link;
+			prev = prev->next;
+			local_ops_per_chain += 1;
+		}
+	}
+
+	prev->next = root;
+
+	Run::global_mutex.lock();
+	Run::_ops_per_chain = local_ops_per_chain;
+	Run::global_mutex.unlock();
+
+	return root;
+}
+
+Chain*
+Run::reverse_mem_init(Chain *mem) {
+	Chain* root = 0;
+	Chain* prev = 0;
+	int link_within_line = 0;
+	int64 local_ops_per_chain = 0;
+
+	int stride = -this->exp->stride;
+	int last;
+	for (int i = 0; i < this->exp->lines_per_chain; i += stride) {
+		last = i;
+	}
+
+	for (int i = last; 0 <= i; i -= stride) {
+		int link = i * this->exp->links_per_line + link_within_line;
+		if (root == 0) {
+			prev = root = mem + link;
+			local_ops_per_chain += 1;
+		} else {
+			prev->next = mem + link;
+			prev = prev->next;
+			local_ops_per_chain += 1;
+		}
+	}
+
+	prev->next = root;
+
+	Run::global_mutex.lock();
+	Run::_ops_per_chain = local_ops_per_chain;
+	Run::global_mutex.unlock();
+
+	return root;
+}
+
+// flush every line of the chains, so the
+// next walk starts with a cold cache
+static void flush_chains(const Chain** root, int64 chains_per_thread,
+		int32 flush_instruction) {
+	for (int i = 0; i < chains_per_thread; i++) {
+		const Chain* p = root[i];
+		do {
+			const Chain* next = p->next;
+			switch (flush_instruction) {
+			case Experiment::CLFLUSHOPT:
+				__asm__ __volatile__("clflushopt %0" : "+m"(*(volatile char*) p));
+				break;
+			case Experiment::CLWB:
+				__asm__ __volatile__("clwb %0" : "+m"(*(volatile char*) p));
+				break;
+			case Experiment::CLFLUSH:
+			default:
+				__asm__ __volatile__("clflush %0" : "+m"(*(volatile char*) p));
+				break;
+			}
+			p = next;
+		} while (p != root[i]);
+	}
+
+	// wait for the flushes to complete
+	__asm__ __volatile__("mfence" : : : "memory");
+}
+
+Chain*
+Run::skewed_mem_init(Chain *mem) {
+	// initialize pointers --
+	// decide how often every line is visited,
+	// using a different link within the line
+	// for every visit, then chain all visits
+	// in random order.
+	int64 lines = this->exp->lines_per_chain;
+	int64 links_per_line = this->exp->links_per_line;
+	std::vector<int64> visits(lines, 0);
+
+	// we must set a lock because random()
+	// is not thread safe
+	Run::global_mutex.lock();
+	setstate(this->exp->random_state[this->thread_id()]);
+
+	// rank the lines at random
+	std::vector<int64> rank(lines);
+	for (int64 i = 0; i < lines; i++) {
+		rank[i] = i;
+	}
+	for (int64 i = lines - 1; 0 < i; i--) {
+		std::swap(rank[i], rank[random() % (i + 1)]);
+	}
+
+	if (this->exp->access_pattern == Experiment::ZIPF) {
+		// draw as many visits as there are lines, the line of
+		// rank r receiving a share proportional to 1/r^s.
+		// fractions of visits are rounded stochastically.
+		double harmonic = 0;
+		for (int64 r = 1; r <= lines; r++) {
+			harmonic += pow((double) r, -this->exp->zipf_exponent);
+		}
+		for (int64 r = 1; r <= lines; r++) {
+			double expected = lines * pow((double) r, -this->exp->zipf_exponent)
+					/ harmonic;
+			int64 count = (int64) expected;
+			if ((double) random() / RAND_MAX < expected - count)
+				count += 1;
+			visits[rank[r - 1]] = std::min(count, links_per_line);
+		}
+	} else {
+		// visit the hot lines several times,
+		// and every cold line once
+		int64 hot_lines = std::max((int64) 1,
+				(int64) (this->exp->hot_fraction * lines));
+		int64 hot_visits = std::min(this->exp->hot_visits(), links_per_line);
+		for (int64 r = 0; r < lines; r++) {
+			visits[rank[r]] = r < hot_lines ? hot_visits : 1;
+		}
+	}
+
+	// one link for every visit, in random order
+	std::vector<int64> links;
+	for (int64 i = 0; i < lines; i++) {
+		for (int64 j = 0; j < visits[i]; j++) {
+			links.push_back(i * links_per_line + j);
+		}
+	}
+	for (int64 i = (int64) links.size() - 1; 0 < i; i--) {
+		std::swap(links[i], links[random() % (i + 1)]);
+	}
+	Run::global_mutex.unlock();
+
+	// chain the links, and close the cycle
+	for (int64 i = 0; i + 1 < (int64) links.size(); i++) {
+		mem[links[i]].next = mem + links[i + 1];
+	}
+	Chain* root = mem + links[0];
+	mem[links.back()].next = root;
+
+	Run::global_mutex.lock();
+	Run::_ops_per_chain = links.size();
+	Run::global_mutex.unlock();
+
+	return root;
+}
+
+Chain*
+Run::pages_mem_init(Chain *mem) {
+	// initialize pointers --
+	// visit the pages walked in random or
+	// strided order, and a few random lines
+	// within every page before moving on,
+	// so every line visited but the first
+	// hits the translation of its page.
+	// short walks repeat through the other
+	// links of the lines, then through more
+	// lines of the pages, until a walk is
+	// long enough to hide the overhead of
+	// the call.
+	int64 pages = this->exp->pages_per_walk;
+	int64 lines = this->exp->lines_per_visit;
+	int64 links_per_line = this->exp->links_per_line;
+	int64 rounds = (Experiment::MIN_LOADS_PER_WALK + pages * lines - 1)
+			/ (pages * lines);
+	int64 draws = std::min(this->exp->lines_per_page / lines,
+			(rounds + links_per_line - 1) / links_per_line);
+	rounds = std::min(rounds, draws * links_per_line);
+	int64 stride = std::max(this->exp->page_stride, (int64) 1);
+	std::vector<int64> page(pages);
+	for (int64 i = 0; i < pages; i++) {
+		page[i] = i * stride;
+	}
+	std::vector<int64> line(this->exp->lines_per_page);
+	for (int64 i = 0; i < this->exp->lines_per_page; i++) {
+		line[i] = i;
+	}
+
+	// we must set a lock because random()
+	// is not thread safe
+	Run::global_mutex.lock();
+	setstate(this->exp->random_state[this->thread_id()]);
+	if (this->exp->page_stride == 0) {
+		for (int64 i = pages - 1; 0 < i; i--) {
+			std::swap(page[i], page[random() % (i + 1)]);
+		}
+	}
+	std::vector<int64> drawn;
+	for (int64 i = 0; i < pages; i++) {
+		// draw distinct lines within the page
+		for (int64 j = 0; j < draws * lines; j++) {
+			std::swap(line[j], line[j + random() % (line.size() - j)]);
+			drawn.push_back(line[j]);
+		}
+	}
+	Run::global_mutex.unlock();
+
+	std::vector<int64> links;
+	for (int64 r = 0; r < rounds; r++) {
+		int64 draw = r / links_per_line;
+		for (int64 i = 0; i < pages; i++) {
+			for (int64 j = 0; j < lines; j++) {
+				links.push_back(page[i] * this->exp->links_per_page
+						+ drawn[(i * draws + draw) * lines + j] * links_per_line
+						+ r % links_per_line);
 			}
-			this->bp->barrier();
+		}
+	}
 
-			// chase pointers
-			for (int i = 0; i < iters; i++)
-				bench((const Chain**) root);
+	// chain the links, and close the cycle
+	for (int64 i = 0; i + 1 < (int64) links.size(); i++) {
+		mem[links[i]].next = mem + links[i + 1];
+	}
+	Chain* root = mem + links[0];
+	mem[links.back()].next = root;
 
-			// barrier
-			this->bp->barrier();
+	Run::global_mutex.lock();
+	Run::_ops_per_chain = links.size();
+	Run::global_mutex.unlock();
 
-			// stop timer
-			if (this->thread_id() == 0) {
-				istop = Timer::seconds();
-				elapsed = istop - istart;
-			}
-			this->bp->barrier();
-		}
+	return root;
+}
 
-		// calculate the number of iterations
-		if (this->thread_id() == 0) {
-			if (0 < this->exp->seconds) {
-				this->exp->iterations = std::max(1.0,
-						0.9999 + 0.5 * this->exp->seconds * iters / elapsed);
-			} else {
-				this->exp->iterations = std::max(1.0, 0.9999 + iters / elapsed);
+Chain*
+Run::conflict_mem_init(Chain *mem) {
+	// initialize pointers --
+	// visit lines a whole number of set
+	// strides apart in random order, so
+	// all of them compete for one set.
+	// the cycle repeats through the other
+	// links of the lines, then through the
+	// lines of further sets, until a walk
+	// is long enough to hide the overhead
+	// of the call.
+	int64 ways = this->exp->conflict_ways;
+	int64 links_per_line = this->exp->links_per_line;
+	int64 links_per_stride = this->exp->conflict_stride / this->exp->pointer_size;
+	int64 sets = std::min(links_per_stride / links_per_line,
+			(Experiment::MIN_LOADS_PER_WALK + ways * links_per_line - 1)
+			/ (ways * links_per_line));
+	std::vector<int64> way(ways);
+	for (int64 i = 0; i < ways; i++) {
+		way[i] = i * links_per_stride;
+	}
+
+	// we must set a lock because random()
+	// is not thread safe
+	Run::global_mutex.lock();
+	setstate(this->exp->random_state[this->thread_id()]);
+	for (int64 i = ways - 1; 0 < i; i--) {
+		std::swap(way[i], way[random() % (i + 1)]);
+	}
+	Run::global_mutex.unlock();
+
+	std::vector<int64> links;
+	for (int64 s = 0; s < sets; s++) {
+		for (int64 j = 0; j < links_per_line; j++) {
+			for (int64 i = 0; i < ways; i++) {
+				links.push_back(way[i] + s * links_per_line + j);
 			}
-			//printf("Tested %d iterations: took %f seconds; scheduling %d iterations\n", iters, elapsed, this->exp->iterations);
 		}
-		this->bp->barrier();
 	}
 
-	// run the experiments
-	for (int e = 0; e < this->exp->experiments; e++) {
-		// barrier
-		this->bp->barrier();
-
-		// start timer
-		double start = 0;
-		if (this->thread_id() == 0)
-			start = Timer::seconds();
-		this->bp->barrier();
+	// chain the links, and close the cycle
+	for (int64 i = 0; i + 1 < (int64) links.size(); i++) {
+		mem[links[i]].next = mem + links[i + 1];
+	}
+	Chain* root = mem + links[0];
+	mem[links.back()].next = root;
 
-		// chase pointers
-		for (int i = 0; i < this->exp->iterations; i++)
-			bench((const Chain**) root);
+	Run::global_mutex.lock();
+	Run::_ops_per_chain = links.size();
+	Run::global_mutex.unlock();
 
-		// barrier
-		this->bp->barrier();
+	return root;
+}
 
-		// stop timer
-		double stop = 0;
-		if (this->thread_id() == 0)
-			stop = Timer::seconds();
-		this->bp->barrier();
+// an order of pages by the masked bits of their physical addresses
+struct PhysicalOrder {
+	const std::vector<uint64>* address;
+	uint64 mask;
+	bool operator()(int64 a, int64 b) const {
+		return ((*address)[a] & mask) < ((*address)[b] & mask);
+	}
+};
 
-		if (0 <= e) {
-			if (this->thread_id() == 0) {
-				double delta = stop - start;
-				if (0 < delta) {
-					Run::_seconds.push_back(delta);
-				}
-			}
+Chain*
+Run::physical_mem_init(Chain *mem, Chain *root) {
+	// relocate a chain built in the first pages
+	// of its memory, keeping every link at its
+	// offset within its page --
+	// selected chains move page by page to the
+	// pages of the pool whose masked physical
+	// address bits match, grouped chains give
+	// the pages they visit first the pages
+	// with the lowest masked bits.
+	int64 links_per_page = this->exp->links_per_page;
+	int64 pages = this->exp->pages_per_chain;
+	int64 pool = this->exp->physical_pages;
+
+	// the links of the chain in the order visited
+	std::vector<Chain*> links;
+	Chain* p = root;
+	do {
+		links.push_back(p);
+		p = p->next;
+	} while (p != root);
+
+	// the physical address of every page of the pool
+	std::vector<uint64> address(pool);
+	for (int64 i = 0; i < pool; i++) {
+		address[i] = PageMap::physical(mem + i * links_per_page);
+		if (address[i] == 0) {
+			fprintf(stderr, "Cannot find the physical address of a chain page.\n");
+			::exit(1);
 		}
 	}
 
-	this->bp->barrier();
+	std::vector<int64> target(pages);
+	if (this->exp->physical_select) {
+		int64 found = 0;
+		for (int64 i = 0; i < pool && found < pages; i++) {
+			if ((address[i] & this->exp->physical_mask) == this->exp->physical_value)
+				target[found++] = i;
+		}
+		if (found < pages) {
+			fprintf(stderr, "Cannot find %lld pages with physical address bits 0x%llx "
+					"equal to 0x%llx among %lld pages.\n", pages,
+					this->exp->physical_mask, this->exp->physical_value, pool);
+			::exit(1);
+		}
+	} else {
+		// rank the pages by their first visit
+		std::vector<int64> rank(pages, -1);
+		int64 ranked = 0;
+		for (int64 i = 0; i < (int64) links.size(); i++) {
+			int64 page = (links[i] - mem) / links_per_page;
+			if (rank[page] < 0)
+				rank[page] = ranked++;
+		}
+		for (int64 i = 0; i < pages; i++) {
+			if (rank[i] < 0)
+				rank[i] = ranked++;
+		}
 
-	// clean the memory
-	for (int i = 0; i < this->exp->chains_per_thread; i++) {
-		if (chain_memory[i] != NULL
-			) delete[] chain_memory[i];
+		std::vector<int64> sorted(pages);
+		for (int64 i = 0; i < pages; i++) {
+			sorted[i] = i;
+		}
+		PhysicalOrder order = { &address, this->exp->physical_mask };
+		std::stable_sort(sorted.begin(), sorted.end(), order);
+		for (int64 i = 0; i < pages; i++) {
+			target[i] = sorted[rank[i]];
+		}
 	}
-	if (chain_memory != NULL
-		) delete[] chain_memory;
 
-	return 0;
+	// chain the relocated links, and close the cycle
+	std::vector<Chain*> moved(links.size());
+	for (int64 i = 0; i < (int64) links.size(); i++) {
+		int64 link = links[i] - mem;
+		moved[i] = mem + target[link / links_per_page] * links_per_page
+				+ link % links_per_page;
+	}
+	for (int64 i = 0; i < (int64) moved.size(); i++) {
+		moved[i]->next = moved[(i + 1) % moved.size()];
+	}
+
+	return moved[0];
 }
 
-int dummy = 0;
-void Run::mem_check(Chain *m) {
-	if (m == NULL
-		) dummy += 1;
+#if defined(NUMA)
+// an order of pages by their visits, most visited first when hot
+struct VisitOrder {
+	const std::vector<int64>* visits;
+	bool hot;
+	bool operator()(int64 a, int64 b) const {
+		return hot ? (*visits)[b] < (*visits)[a] : (*visits)[a] < (*visits)[b];
+	}
+};
+
+// the most visited pages of a chain (the least, when cold)
+// move to the far tier, whole pages of the chain memory only
+void
+Run::far_tier(Chain *mem, Chain *root) {
+	int64 page = sysconf(_SC_PAGESIZE);
+	uint64 begin = ((uint64) mem + page - 1) / page * page;
+	uint64 end = ((uint64) mem + Memory::chain_bytes(this->exp)) / page * page;
+	if (end <= begin)
+		return;
+
+	// the visits of every page in one walk
+	int64 pages = (end - begin) / page;
+	std::vector<int64> visits(pages, 0);
+	int64 total = 0;
+	Chain* p = root;
+	do {
+		uint64 address = (uint64) p;
+		if (begin <= address && address < end)
+			visits[(address - begin) / page] += 1;
+		total += 1;
+		p = p->next;
+	} while (p != root);
+
+	// order the visited pages, hottest first unless cold
+	std::vector<int64> sorted;
+	for (int64 i = 0; i < pages; i++) {
+		if (0 < visits[i])
+			sorted.push_back(i);
+	}
+	VisitOrder order = { &visits, this->exp->tier_hot };
+	std::stable_sort(sorted.begin(), sorted.end(), order);
+
+	int64 far = (int64) (this->exp->tier_fraction * sorted.size() + 0.5);
+	int64 far_visits = 0;
+	sorted.resize(far);
+	std::sort(sorted.begin(), sorted.end());
+	for (int64 i = 0; i < far; i++) {
+		int64 first = i;
+		while (i + 1 < far && sorted[i + 1] == sorted[i] + 1)
+			i += 1;
+		Memory::bind((void*) (begin + sorted[first] * page),
+				(sorted[i] - sorted[first] + 1) * page, this->exp->tier_node);
+		for (int64 j = first; j <= i; j++) {
+			far_visits += visits[sorted[j]];
+		}
+	}
+
+	Run::global_mutex.lock();
+	Run::_tier_visits += total;
+	Run::_far_visits += far_visits;
+	this->exp->tier_share = (double) Run::_far_visits / Run::_tier_visits;
+	Run::global_mutex.unlock();
 }
+#endif
 
-// exclude 2 and Mersenne primes, i.e.,
-// primes of the form 2**n - 1, e.g.,
-// 3, 7, 31, 127
-static const int prime_table[] = { 5, 11, 13, 17, 19, 23, 37, 41, 43, 47, 53,
-		61, 71, 73, 79, 83, 89, 97, 101, 103, 109, 113, 131, 137, 139, 149, 151,
-		157, 163, };
-static const int prime_table_size = sizeof prime_table / sizeof prime_table[0];
+// the bank of a physical address, every bit of which
+// is the parity of the address bits under its mask
+static uint64 dram_bank(const Experiment* exp, uint64 address) {
+	uint64 bank = 0;
+	for (int i = 0; i < exp->dram_bank_bits; i++) {
+		bank |= (uint64) __builtin_parityll(address & exp->dram_banks[i]) << i;
+	}
+
+	return bank;
+}
 
 Chain*
-Run::random_mem_init(Chain *mem) {
+Run::dram_mem_init(Chain *mem) {
 	// initialize pointers --
-	// choose a page at random, then use
-	// one pointer from each cache line
-	// within the page.  all pages and
-	// cache lines are chosen at random.
-	Chain* root = 0;
-	Chain* prev = 0;
-	int link_within_line = 0;
-	int64 local_ops_per_chain = 0;
+	// classify every line of the chain by the
+	// bank and row of its physical address,
+	// then visit the lines of the largest row
+	// (row hits), one line of every row of the
+	// bank with most rows (row conflicts), or
+	// the lines of the largest row of every bank,
+	// a different bank on every visit.
+	int64 base_page = sysconf(_SC_PAGESIZE);
+	int64 links_per_line = this->exp->links_per_line;
+	int64 lines_per_base_page = base_page / this->exp->bytes_per_line;
+	std::map<uint64, std::map<uint64, std::vector<int64> > > banks;
+	for (int64 page = 0; page * base_page < this->exp->bytes_per_chain; page++) {
+		uint64 address = PageMap::physical(
+				(char*) mem + page * base_page);
+		if (address == 0) {
+			fprintf(stderr, "Cannot find the physical address of a chain page.\n");
+			::exit(1);
+		}
+		for (int64 j = 0; j < lines_per_base_page; j++) {
+			uint64 line = address + j * this->exp->bytes_per_line;
+			banks[dram_bank(this->exp, line)][line & this->exp->dram_row_mask]
+					.push_back(page * lines_per_base_page + j);
+		}
+	}
+
+	std::vector<int64> lines;
+	std::map<uint64, std::map<uint64, std::vector<int64> > >::iterator b;
+	std::map<uint64, std::vector<int64> >::iterator r;
+	if (this->exp->dram_class == Experiment::ROW_HIT) {
+		for (b = banks.begin(); b != banks.end(); b++) {
+			for (r = b->second.begin(); r != b->second.end(); r++) {
+				if (lines.size() < r->second.size())
+					lines = r->second;
+			}
+		}
+	} else if (this->exp->dram_class == Experiment::ROW_CONFLICT) {
+		std::map<uint64, std::map<uint64, std::vector<int64> > >::iterator most = banks.begin();
+		for (b = banks.begin(); b != banks.end(); b++) {
+			if (most->second.size() < b->second.size())
+				most = b;
+		}
+		for (r = most->second.begin(); r != most->second.end(); r++) {
+			lines.push_back(r->second.front());
+		}
+	}
 
 	// we must set a lock because random()
 	// is not thread safe
 	Run::global_mutex.lock();
 	setstate(this->exp->random_state[this->thread_id()]);
-	int page_factor = prime_table[random() % prime_table_size];
-	int page_offset = random() % this->exp->pages_per_chain;
-	Run::global_mutex.unlock();
-
-	// loop through the pages
-	for (int i = 0; i < this->exp->pages_per_chain; i++) {
-		int page = (page_factor * i + page_offset) % this->exp->pages_per_chain;
-		Run::global_mutex.lock();
-		setstate(this->exp->random_state[this->thread_id()]);
-		int line_factor = prime_table[random() % prime_table_size];
-		int line_offset = random() % this->exp->lines_per_page;
-		Run::global_mutex.unlock();
-
-		// loop through the lines within a page
-		for (int j = 0; j < this->exp->lines_per_page; j++) {
-			int line_within_page = (line_factor * j + line_offset)
-					% this->exp->lines_per_page;
-			int link = page * this->exp->links_per_page
-					+ line_within_page * this->exp->links_per_line
-					+ link_within_line;
-
-			if (root == 0) {
-				prev = root = mem + link;
-				local_ops_per_chain += 1;
-			} else {
-				prev->next = mem + link;
-				prev = prev->next;
-				local_ops_per_chain += 1;
+	if (this->exp->dram_class == Experiment::BANK_SPREAD) {
+		// the largest row of every bank, in random
+		// order, visited round-robin over the banks
+		// as long as every row has lines left
+		std::vector<std::vector<int64> > rows;
+		for (b = banks.begin(); b != banks.end(); b++) {
+			std::vector<int64>* largest = NULL;
+			for (r = b->second.begin(); r != b->second.end(); r++) {
+				if (largest == NULL || largest->size() < r->second.size())
+					largest = &r->second;
+			}
+			rows.push_back(*largest);
+		}
+		size_t rounds = rows.front().size();
+		for (size_t i = 0; i < rows.size(); i++) {
+			for (int64 j = (int64) rows[i].size() - 1; 0 < j; j--) {
+				std::swap(rows[i][j], rows[i][random() % (j + 1)]);
+			}
+			rounds = std::min(rounds, rows[i].size());
+		}
+		for (int64 i = (int64) rows.size() - 1; 0 < i; i--) {
+			std::swap(rows[i], rows[random() % (i + 1)]);
+		}
+		for (size_t k = 0; 1 < rows.size() && k < rounds; k++) {
+			for (size_t i = 0; i < rows.size(); i++) {
+				lines.push_back(rows[i][k]);
 			}
 		}
+	} else {
+		for (int64 i = (int64) lines.size() - 1; 0 < i; i--) {
+			std::swap(lines[i], lines[random() % (i + 1)]);
+		}
+	}
+	Run::global_mutex.unlock();
+
+	if (lines.size() < 2) {
+		fprintf(stderr, "Cannot find lines of dram class '%s' in the chain; "
+				"check the dram address mapping or enlarge the chain.\n",
+				this->exp->dram());
+		::exit(1);
 	}
 
-	prev->next = root;
+	// chain the lines, and close the cycle
+	for (int64 i = 0; i + 1 < (int64) lines.size(); i++) {
+		mem[lines[i] * links_per_line].next = mem + lines[i + 1] * links_per_line;
+	}
+	Chain* root = mem + lines[0] * links_per_line;
+	mem[lines.back() * links_per_line].next = root;
 
 	Run::global_mutex.lock();
-	Run::_ops_per_chain = local_ops_per_chain;
+	Run::_ops_per_chain = lines.size();
 	Run::global_mutex.unlock();
 
 	return root;
 }
 
 Chain*
-Run::forward_mem_init(Chain *mem) {
+Run::trace_mem_init(Chain *mem) {
+	// initialize pointers --
+	// replay the trace, mapping its pages onto
+	// the pages of the chain in order of first
+	// use and keeping the line within the page.
+	// every visit of a line uses the next link
+	// within it, so no link is used twice, and
+	// repeat visits of the line just visited are
+	// folded into one, as they always hit.
+	FILE* trace = fopen(this->exp->trace_file, "rb");
+	if (trace == NULL) {
+		fprintf(stderr, "Cannot open trace file '%s'.\n", this->exp->trace_file);
+		::exit(1);
+	}
+	bool text = is_text_trace(trace);
+
+	std::map<uint64, int64> page_map;
+	std::vector<int64> links_used(this->exp->lines_per_chain, 0);
 	Chain* root = 0;
 	Chain* prev = 0;
-	int link_within_line = 0;
+	int64 prev_line = -1;
 	int64 local_ops_per_chain = 0;
+	const char* truncated = NULL;
+
+	uint64 address;
+	while (read_address(trace, text, &address)) {
+		uint64 trace_page = address / this->exp->bytes_per_page;
+		int64 line_within_page = (address % this->exp->bytes_per_page)
+				/ this->exp->bytes_per_line;
+
+		std::map<uint64, int64>::iterator it = page_map.find(trace_page);
+		if (it == page_map.end()) {
+			if ((int64) page_map.size() == this->exp->pages_per_chain) {
+				truncated = "the trace touches more pages than the chain holds";
+				break;
+			}
+			int64 page = page_map.size();
+			it = page_map.insert(std::make_pair(trace_page, page)).first;
+		}
 
-	for (int i = 0; i < this->exp->lines_per_chain; i += this->exp->stride) {
-		int link = i * this->exp->links_per_line + link_within_line;
-		if (root == NULL) {
+		int64 line = it->second * this->exp->lines_per_page + line_within_page;
+		if (line == prev_line)
+			continue;
+		prev_line = line;
+		if (links_used[line] == this->exp->links_per_line) {
+			truncated = "a line is visited more often than it has links";
+			break;
+		}
+		int64 link = line * this->exp->links_per_line + links_used[line];
+		links_used[line] += 1;
+
+		if (root == 0) {
 			prev = root = mem + link;
 			local_ops_per_chain += 1;
 		} else {
@@ -302,10 +1732,28 @@ Run::forward_mem_init(Chain *mem) {
 			local_ops_per_chain += 1;
 		}
 	}
+	fclose(trace);
+
+	if (root == 0) {
+		fprintf(stderr, "Trace file '%s' holds no addresses.\n", this->exp->trace_file);
+		::exit(1);
+	}
 
 	prev->next = root;
 
+	if (truncated != NULL && this->exp->strict) {
+		fprintf(stderr, "Cannot replay trace file '%s' beyond %lld addresses: %s.\n",
+				this->exp->trace_file, local_ops_per_chain, truncated);
+		::exit(1);
+	}
+
 	Run::global_mutex.lock();
+	static bool reported = false;
+	if (truncated != NULL && !reported) {
+		fprintf(stderr, "Trace replay stopped after %lld addresses: %s.\n",
+				local_ops_per_chain, truncated);
+		reported = true;
+	}
 	Run::_ops_per_chain = local_ops_per_chain;
 	Run::global_mutex.unlock();
 
@@ -313,49 +1761,178 @@ Run::forward_mem_init(Chain *mem) {
 }
 
 Chain*
-Run::reverse_mem_init(Chain *mem) {
+Run::loaded_mem_init(Chain *mem, int chain) {
+	// initialize pointers --
+	// link the chain in the order recorded in
+	// the chain file, relocating the offsets to
+	// this memory. threads and chains beyond
+	// those in the file reuse its chains.
+	const ChainFile* file = this->exp->chain_file;
+	const ChainFile::Header& h = file->header();
+	int64 stored = (this->thread_id() % h.threads) * h.chains_per_thread
+			+ chain % h.chains_per_thread;
+	int64 length = file->length(stored);
+
 	Chain* root = 0;
 	Chain* prev = 0;
-	int link_within_line = 0;
-	int64 local_ops_per_chain = 0;
-
-	int stride = -this->exp->stride;
-	int last;
-	for (int i = 0; i < this->exp->lines_per_chain; i += stride) {
-		last = i;
-	}
+	for (int64 i = 0; i < length; i++) {
+		int64 link = file->link(stored, i);
+		if (link < 0 || this->exp->links_per_chain <= link) {
+			fprintf(stderr, "Chain file '%s' is corrupt.\n", this->exp->load_chain);
+			::exit(1);
+		}
 
-	for (int i = last; 0 <= i; i -= stride) {
-		int link = i * this->exp->links_per_line + link_within_line;
 		if (root == 0) {
 			prev = root = mem + link;
-			local_ops_per_chain += 1;
 		} else {
 			prev->next = mem + link;
 			prev = prev->next;
-			local_ops_per_chain += 1;
 		}
 	}
 
 	prev->next = root;
 
 	Run::global_mutex.lock();
-	Run::_ops_per_chain = local_ops_per_chain;
+	Run::_ops_per_chain = length;
 	Run::global_mutex.unlock();
 
 	return root;
 }
 
+// record the links of the chains built by this
+// thread, then have the first thread write them
+void Run::save_chains(Chain** memory, Chain** root, bool owner) {
+	for (int i = 0; owner && i < this->exp->chains_per_thread; i++) {
+		std::vector<int64> links;
+		Chain* p = root[i];
+		do {
+			links.push_back(p - memory[i]);
+			p = p->next;
+		} while (p != root[i]);
+
+		Run::global_mutex.lock();
+		Run::_saved[this->thread_id() * this->exp->chains_per_thread + i].swap(links);
+		Run::global_mutex.unlock();
+	}
+
+	this->bp->barrier();
+
+	if (this->thread_id() == 0) {
+		ChainFile::Header h;
+		ChainFile::init(h);
+		h.pointer_size = this->exp->pointer_size;
+		h.bytes_per_line = this->exp->bytes_per_line;
+		h.bytes_per_page = this->exp->bytes_per_page;
+		h.bytes_per_chain = this->exp->bytes_per_chain;
+		h.threads = Run::_saved.size() / this->exp->chains_per_thread;
+		h.chains_per_thread = this->exp->chains_per_thread;
+		h.access_pattern = this->exp->access_pattern;
+		h.stride = this->exp->stride;
+		h.zipf_exponent = this->exp->zipf_exponent;
+		h.hot_fraction = this->exp->hot_fraction;
+		h.hot_share = this->exp->hot_share;
+
+		std::vector<std::vector<int64> > chains;
+		for (std::map<int64, std::vector<int64> >::iterator it =
+				Run::_saved.begin(); it != Run::_saved.end(); it++) {
+			chains.push_back(std::vector<int64>());
+			chains.back().swap(it->second);
+		}
+		Run::_saved.clear();
+
+		if (!ChainFile::save(this->exp->save_chain, h, chains)) {
+			fprintf(stderr, "Cannot write chain file '%s'.\n", this->exp->save_chain);
+			::exit(1);
+		}
+	}
+}
+
+// a trace is text when its first bytes are printable
+static bool is_text_trace(FILE* trace) {
+	unsigned char buffer[256];
+	size_t size = fread(buffer, 1, sizeof(buffer), trace);
+	rewind(trace);
+
+	for (size_t i = 0; i < size; i++) {
+		if (!isprint(buffer[i]) && !isspace(buffer[i]))
+			return false;
+	}
+
+	return true;
+}
+
+// read the next address of a trace, skipping
+// comments and blank lines of text traces
+static bool read_address(FILE* trace, bool text, uint64* address) {
+	if (!text) {
+		return fread(address, sizeof(uint64), 1, trace) == 1;
+	}
+
+	char line[256];
+	while (fgets(line, sizeof(line), trace) != NULL) {
+		// discard the remainder of overlong lines
+		if (strchr(line, '\n') == NULL) {
+			int c;
+			while ((c = getc(trace)) != EOF && c != '\n')
+				;
+		}
+
+		char* start = line;
+		while (isspace(*start))
+			start++;
+		if (*start == '\0' || *start == '#')
+			continue;
+
+		// base 0 would read zero-padded decimals as octal
+		int base = 10;
+		if (start[0] == '0' && (start[1] == 'x' || start[1] == 'X'))
+			base = 16;
+		char* end;
+		*address = strtoull(start, &end, base);
+		if (end != start)
+			return true;
+	}
+
+	return false;
+}
+
 static benchmark chase_pointers(int64 chains_per_thread, // memory loading per thread
 		int64 bytes_per_line, // ignored
 		int64 bytes_per_chain, // ignored
 		int64 stride, // ignored
 		int64 loop_length, // length of the inner loop
-		int32 prefetch_hint // use of prefetching
+		int32 prefetch_hint, // use of prefetching
+		int32 flush_scope, // flushing of visited lines
+		int32 flush_instruction, // instruction used to flush
+		int32 atomic_op, // atomic operation on every visited line
+		int64 atomic_offset, // offset of the word updated atomically
+		const char* dump_file // file to dump the generated code to, or NULL
 		) {
 	// Create Compiler.
 	AsmJit::Compiler c;
 
+	// Log the generated code, if requested.
+	FILE* listing = NULL;
+	AsmJit::FileLogger logger;
+	if (dump_file != NULL) {
+		listing = fopen(dump_file, "w");
+		if (listing == NULL) {
+			fprintf(stderr, "Cannot open jit dump file '%s'.\n", dump_file);
+			exit(1);
+		}
+		fprintf(listing, "; chase_pointers(chains_per_thread=%lld, loop_length=%lld, "
+				"prefetch_hint=%s, flush=%s, atomic=%s, atomic_offset=%lld)\n",
+				chains_per_thread, loop_length,
+				prefetch_hint_string(prefetch_hint),
+				flush_scope == Experiment::NO_FLUSH ? "none"
+						: flush_instruction_string(flush_instruction),
+				atomic_op_string(atomic_op),
+				atomic_offset);
+		logger.setStream(listing);
+		logger.setLogBinary(true);
+		c.setLogger(&logger);
+	}
+
   	// Tell compiler the function prototype we want. It allocates variables representing
 	// function arguments that can be accessed through Compiler or Function instance.
 	c.newFunction(AsmJit::CALL_CONV_DEFAULT, AsmJit::FunctionBuilder1<AsmJit::Void, const Chain**>());
@@ -385,11 +1962,57 @@ static benchmark chase_pointers(int64 chains_per_thread, // memory loading per t
 		positions[i] = position;
 	}
 
+	// Previous position, only used when flushing lines
+	std::vector<AsmJit::GPVar> previous(chains_per_thread);
+	if (flush_scope == Experiment::LINE_FLUSH) {
+		for (int i = 0; i < chains_per_thread; i++) {
+			previous[i] = c.newGP();
+		}
+	}
+
+	// Values used by the atomic operations
+	AsmJit::GPVar value;
+	AsmJit::GPVar update;
+	if (atomic_op != Experiment::NO_ATOMIC) {
+		value = c.newGP();
+		c.xor_(value, value);
+	}
+	if (atomic_op == Experiment::CMPXCHG) {
+		update = c.newGP();
+	}
+
 	// Loop.
 	c.bind(L_Loop);
 
 	// Process all links
 	for (int i = 0; i < chains_per_thread; i++) {
+		// Remember the line we are about to leave
+		if (flush_scope == Experiment::LINE_FLUSH)
+			c.mov(previous[i], positions[i]);
+
+		// Update the line we are about to leave,
+		// so the chase itself hits in the cache
+		switch (atomic_op)
+		{
+		case Experiment::XADD:
+			c.mov(value, AsmJit::imm(1));
+			c.lock();
+			c.xadd(ptr(positions[i], atomic_offset), value);
+			break;
+		case Experiment::CMPXCHG:
+			c.mov(update, value);
+			c.add(update, AsmJit::imm(1));
+			c.lock();
+			c.cmpxchg(value, ptr(positions[i], atomic_offset), update);
+			break;
+		case Experiment::XCHG:
+			c.xchg(ptr(positions[i], atomic_offset), value);
+			break;
+		case Experiment::NO_ATOMIC:
+		default:
+			break;
+		}
+
 		// Chase pointer
 		c.mov(positions[i], ptr(positions[i], offsetof(Chain, next)));
 
@@ -413,6 +2036,23 @@ static benchmark chase_pointers(int64 chains_per_thread, // memory loading per t
 			break;
 
 		}
+
+		// Flush the line we just left
+		if (flush_scope == Experiment::LINE_FLUSH) {
+			switch (flush_instruction)
+			{
+			case Experiment::CLFLUSHOPT:
+				c.clflushopt(ptr(previous[i]));
+				break;
+			case Experiment::CLWB:
+				c.clwb(ptr(previous[i]));
+				break;
+			case Experiment::CLFLUSH:
+			default:
+				c.clflush(ptr(previous[i]));
+				break;
+			}
+		}
 	}
 
 	// Wait
@@ -423,6 +2063,11 @@ static benchmark chase_pointers(int64 chains_per_thread, // memory loading per t
 	c.cmp(heads[0], positions[0]);
 	c.jne(L_Loop);
 
+	// Wait for weakly ordered flushes to complete
+	if (flush_scope == Experiment::LINE_FLUSH
+			&& flush_instruction != Experiment::CLFLUSH)
+		c.sfence();
+
 	// Finish.
 	c.endFunction();
 
@@ -432,8 +2077,40 @@ static benchmark chase_pointers(int64 chains_per_thread, // memory loading per t
 	// Ensure that everything is ok.
 	if (!fn) {
 		printf("Error making jit function (%u).\n", c.getError());
+		if (listing != NULL)
+			fclose(listing);
 		return 0;
 	}
 
+	// Dump the raw machine code next to the listing.
+	if (listing != NULL) {
+		dump_code(dump_file, listing, (void*) fn, c.getCodeSize());
+		fclose(listing);
+	}
+
 	return fn;
 }
+
+// write the raw machine code to <dump_file>.bin, and
+// record its base address so the listing and binary
+// can be disassembled at the addresses that ran
+static void dump_code(const char* dump_file, FILE* listing, void* code,
+		size_t size) {
+	size_t length = strlen(dump_file) + 5;
+	char* binary_file = new char[length];
+	snprintf(binary_file, length, "%s.bin", dump_file);
+
+	FILE* binary = fopen(binary_file, "wb");
+	if (binary == NULL || fwrite(code, 1, size, binary) != size) {
+		fprintf(stderr, "Cannot write jit dump file '%s'.\n", binary_file);
+		exit(1);
+	}
+	fclose(binary);
+
+	fprintf(listing, "; base address %p, %lu bytes written to %s\n",
+			code, (unsigned long) size, binary_file);
+	fprintf(listing, "; objdump -D -b binary -m i386:x86-64 --adjust-vma=%p %s\n",
+			code, binary_file);
+
+	delete[] binary_file;
+}
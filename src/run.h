@@ -20,6 +20,7 @@
 
 // System includes
 #include <vector>
+#include <map>
 
 
 // Local includes
@@ -35,12 +36,17 @@
 // Class definition
 //
 
+typedef void (*benchmark)(const Chain**);
+
+class Pool;
+
 class Run: public Thread {
 public:
 	Run();
 	~Run();
 	int run();
 	void set(Experiment &e, SpinBarrier* sbp);
+	void set(Pool* p);
 
 	static int64 ops_per_chain() {
 		return _ops_per_chain;
@@ -48,19 +54,129 @@ public:
 	static std::vector<double> seconds() {
 		return _seconds;
 	}
+	static std::vector<int64> chains() {
+		return _chains;
+	}
+	static std::vector<int64> iterations() {
+		return _iterations;
+	}
+	static std::vector<int64> threads() {
+		return _threads;
+	}
+	static std::vector<int64> pages() {
+		return _pages;
+	}
+	static std::vector<int64> ways() {
+		return _ways;
+	}
+	static std::vector<int64> dram_classes() {
+		return _dram_classes;
+	}
+	static std::vector<int64> ops() {
+		return _ops;
+	}
+	static std::vector<double> thread_seconds() {
+		return _thread_seconds;
+	}
+	static std::vector<int64> faults() {
+		return _faults;
+	}
+	static std::vector<double> fault_seconds() {
+		return _fault_seconds;
+	}
+	static std::vector<int64> migrated() {
+		return _migrated;
+	}
+	static std::vector<double> migrate_seconds() {
+		return _migrate_seconds;
+	}
+	static std::vector<double> pauses() {
+		return _pauses;
+	}
+	static std::vector<double> latencies() {
+		return _latencies;
+	}
+	static std::vector<double> idle_seconds() {
+		return _idle_seconds;
+	}
+	static std::vector<int64> messages() {
+		return _messages;
+	}
+	static std::vector<double> message_seconds() {
+		return _message_seconds;
+	}
+	static std::vector<double> message_latency() {
+		return _message_latency;
+	}
+	static std::vector<double> message_minimum() {
+		return _message_minimum;
+	}
 
 private:
 	Experiment* exp; // experiment data
 	SpinBarrier* bp; // spin barrier used by all threads
+	Pool* pool; // pool this thread works for, if any
+	Chain** chain_memory; // memory of the chains of this thread
+	Chain** root; // first link of every chain
+
+	int step();
+	void release();
+	void measure(benchmark bench, Chain** root, int64 chains);
+	void monitor(benchmark bench, Chain** root, int64 chains);
+	void migrate(benchmark bench, Chain** root, int64 chains);
+	void interfere(benchmark bench, Chain** root, int64 chains);
+	int fault_in();
+	int stream();
 
 	void mem_check(Chain *m);
 	Chain* random_mem_init(Chain *m);
 	Chain* forward_mem_init(Chain *m);
 	Chain* reverse_mem_init(Chain *m);
+	Chain* skewed_mem_init(Chain *m);
+	Chain* trace_mem_init(Chain *m);
+	Chain* pages_mem_init(Chain *m);
+	Chain* conflict_mem_init(Chain *m);
+	Chain* physical_mem_init(Chain *m, Chain *root);
+	Chain* dram_mem_init(Chain *m);
+#if defined(NUMA)
+	void far_tier(Chain *m, Chain *root);
+#endif
+	Chain* loaded_mem_init(Chain *m, int chain);
+	void save_chains(Chain** memory, Chain** root, bool owner);
 
 	static Lock global_mutex; // global lock
+	static std::map<int64, Chain**> shared_root; // chains of the first thread of every group of sharers
+	static std::map<int64, std::vector<int64> > _saved; // links of every chain to save
 	static int64 _ops_per_chain; // total number of operations per chain
 	static std::vector<double> _seconds; // number of seconds for each experiment
+	static std::vector<int64> _chains; // chains per thread for each experiment
+	static std::vector<int64> _iterations; // number of iterations for each experiment
+	static std::vector<int64> _threads; // number of threads for each experiment
+	static std::vector<int64> _pages; // pages walked for each experiment
+	static std::vector<int64> _ways; // aliasing lines walked for each experiment
+	static std::vector<int64> _dram_classes; // class of dram lines walked for each experiment
+	static std::vector<int64> _ops; // operations per chain for each experiment
+	static int64 _tier_visits; // visits of one walk of every tiered chain
+	static int64 _far_visits; // visits of those walks to pages of the far tier
+	static std::vector<double> _thread_seconds; // seconds of every thread for each experiment
+	static std::vector<double> _lap; // seconds of every thread in the current experiment
+	static std::vector<int64> _lap_iterations; // iterations of every thread in the current sample
+	static std::vector<int64> _walks; // walks of every thread per latency bucket, since a monitor started
+	static std::vector<double> _walk_seconds; // seconds of all walks of every thread, since a monitor started
+	static std::vector<int64> _faults; // page faults of every thread in every experiment
+	static std::vector<double> _fault_seconds; // time taken by every thread in every experiment
+	static std::vector<int64> _migrated; // pages on their target after every thread migrated them
+	static std::vector<double> _migrate_seconds; // time every thread spent migrating in every experiment
+	static std::vector<double> _pauses; // longest migration call of every thread in every experiment
+	static std::vector<double> _latencies; // latency before, during and after every migration
+	static std::vector<double> _idle_seconds; // seconds of every experiment with an idle sibling
+	static volatile int64 _sink; // results of the work of a sibling, kept from the optimizer
+	static volatile int64* _ring; // slots of the ring, written by the first thread
+	static volatile int64* _ring_control; // published, final and consumed counts of messages
+	static std::vector<int64> _messages; // messages every thread wrote or read in every experiment
+	static std::vector<double> _message_seconds; // time every thread streamed in every experiment
+	static std::vector<double> _message_latency; // mean latency of the messages every consumer read
+	static std::vector<double> _message_minimum; // least latency of the messages every consumer read
 };
 
 #endif
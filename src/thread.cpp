@@ -30,7 +30,8 @@ int Thread::count = 0;
 // Implementation
 //
 
-Thread::Thread() {
+Thread::Thread() :
+		cpu(-1) {
 	Thread::global_lock();
 	this->id = Thread::count;
 	Thread::count += 1;
@@ -56,9 +57,12 @@ Thread::start_routine(void* p) {
 	for (; CPU_ISSET(count, &cs); count++);
 
 	// restrict to a single CPU
+	int cpu = ((Thread*) p)->cpu;
+	if (cpu < 0)
+		cpu = ((Thread*) p)->id % count;
 	CPU_ZERO(&cs);
-	size_t size = CPU_ALLOC_SIZE(1);
-	CPU_SET_S(((Thread*) p)->id % count, size, &cs);
+	size_t size = CPU_ALLOC_SIZE(cpu + 1);
+	CPU_SET_S(cpu, size, &cs);
 	pthread_setaffinity_np(pthread_self(), size, &cs);
 
 	// run
@@ -67,6 +71,14 @@ Thread::start_routine(void* p) {
 	return NULL;
 }
 
+// number new threads from zero again,
+// once all earlier threads have ended
+void Thread::reset_ids() {
+	Thread::global_lock();
+	Thread::count = 0;
+	Thread::global_unlock();
+}
+
 void Thread::exit() {
 	pthread_exit(NULL);
 }
@@ -43,8 +43,12 @@ public:
 	int thread_id() {
 		return id;
 	}
+	void set_cpu(int c) {
+		cpu = c;
+	}
 
 	static void exit();
+	static void reset_ids();
 
 protected:
 	~Thread();
@@ -63,6 +67,7 @@ private:
 
 	static int count;
 	int id;
+	int cpu;	// cpu to run on, or -1 to derive it from the id
 	int lock_obj;
 };
 
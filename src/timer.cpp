@@ -19,17 +19,34 @@
 
 // System includes
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <ctime>
+#include <vector>
+#include <algorithm>
+#include <unistd.h>
 #include <sys/time.h>
+#include <sys/stat.h>
+
+// Local includes
+#include <AsmJit/CpuInfo.h>
 
 static int64 read_rtc();
 static void calibrate_rtc(int n);
+static void select_source();
 static double wall_seconds();
+static double measure_cycles_per_second();
+static bool cache_file(char* path, size_t size);
+static bool load_calibration();
+static void save_calibration();
 
 static int wall_ticks = -1;
 static int rtc_ticks = -1;
-static double wall_elapsed = -1;
-static int64 rtc_elapsed = -1;
 static double time_factor = -1;
+static double core_frequency = -1;
+static double time_uncertainty = 0;
+static bool from_cache = false;
 
 #if !defined(RTC) && !defined(GTOD)
 #define RTC
@@ -42,42 +59,58 @@ static double time_factor = -1;
 
 #if defined(RTC)
 
+// the time stamp counter is only used when it runs
+// at a constant rate regardless of power states,
+// otherwise the raw monotonic clock is used
+static bool use_rtc = false;
+static bool use_rdtscp = false;
+
 double Timer::seconds() {
+	if (!use_rtc)
+		return wall_seconds();
+
 	return (double) read_rtc() * time_factor;
 }
 
 int64 Timer::ticks() {
-	// See pg. 406 of the AMD x86-64 Architecture
-	// Programmer's Manual, Volume 2, System Programming
-	unsigned int eax = 0, edx = 0;
-
-	__asm__ __volatile__(
-			"rdtsc ;"
-			"movl %%eax,%0;"
-			"movl %%edx,%1;"
-			""
-			: "=r"(eax), "=r"(edx)
-			:
-			: "%eax", "%edx"
-	);
+	if (!use_rtc)
+		return (int64) (wall_seconds() * 1E9);
 
-	return ((int64) edx << 32) | (int64) eax;
+	return read_rtc();
 }
 
 static int64 read_rtc() {
 	// See pg. 406 of the AMD x86-64 Architecture
-	// Programmer's Manual, Volume 2, System Programming
+	// Programmer's Manual, Volume 2, System Programming.
+	// rdtscp waits for earlier instructions to complete,
+	// and lfence keeps later ones from starting early;
+	// without rdtscp, lfence orders rdtsc on both sides.
 	unsigned int eax = 0, edx = 0;
 
-	__asm__ __volatile__(
-			"rdtsc ;"
-			"movl %%eax,%0;"
-			"movl %%edx,%1;"
-			""
-			: "=r"(eax), "=r"(edx)
-			:
-			: "%eax", "%edx"
-	);
+	if (use_rdtscp) {
+		__asm__ __volatile__(
+				"rdtscp ;"
+				"lfence ;"
+				"movl %%eax,%0;"
+				"movl %%edx,%1;"
+				""
+				: "=r"(eax), "=r"(edx)
+				:
+				: "%eax", "%ecx", "%edx", "memory"
+		);
+	} else {
+		__asm__ __volatile__(
+				"lfence ;"
+				"rdtsc ;"
+				"lfence ;"
+				"movl %%eax,%0;"
+				"movl %%edx,%1;"
+				""
+				: "=r"(eax), "=r"(edx)
+				:
+				: "%eax", "%edx", "memory"
+		);
+	}
 
 	return ((int64) edx << 32) | (int64) eax;
 }
@@ -87,32 +120,91 @@ void Timer::calibrate() {
 }
 
 void Timer::calibrate(int n) {
+	calibrate_rtc(n);
+	core_frequency = measure_cycles_per_second();
+}
+
+// reuse an earlier calibration since boot on the same
+// cpu model if allowed, or calibrate and cache it
+void Timer::calibrate(int n, bool reuse) {
+	select_source();
+	from_cache = reuse && load_calibration();
+	if (from_cache)
+		return;
+
+	Timer::calibrate(n);
+	save_calibration();
+}
+
+static void select_source() {
+	AsmJit::CpuInfo* cpu = AsmJit::getCpuInfo();
+	use_rtc = (cpu->extendedFeatures & AsmJit::CPU_EXTENDED_FEATURE_INVARIANT_TSC) != 0;
+	use_rdtscp = (cpu->features & AsmJit::CPU_FEATURE_RDTSCP) != 0;
+}
+
+// calibrate the time stamp counter against the raw
+// monotonic clock for n microseconds, split into windows
+static void calibrate_rtc(int n) {
+	select_source();
 	wall_ticks = n;
 
-	double wall_start, wall_finish, t;
-	t = wall_seconds();
-	while (t == (wall_start = wall_seconds())) {
-		;
-	}
-	int64 rtc_start = read_rtc();
-	for (int i = 0; i < wall_ticks; i++) {
-		t = wall_seconds();
-		while (t == (wall_finish = wall_seconds())) {
-			;
+	if (use_rtc) {
+		// every window pairs a counter reading with the
+		// midpoint of the clock readings around it
+		const int windows = 7;
+		std::vector<double> factor;
+		double wall_start = 0;
+		int64 rtc_start = 0;
+		for (int w = 0; w <= windows; w++) {
+			double before = wall_seconds();
+			int64 rtc = read_rtc();
+			double wall = (before + wall_seconds()) / 2;
+			if (0 < w)
+				factor.push_back((wall - wall_start) / (double) (rtc - rtc_start));
+			wall_start = wall;
+			rtc_start = rtc;
+
+			while (w < windows && wall_seconds() - wall_start < wall_ticks * 1E-6 / windows)
+				;
+		}
+
+		// reject windows more than three median absolute
+		// deviations off the median, e.g. when preempted
+		// between the readings
+		std::vector<double> sorted(factor);
+		std::sort(sorted.begin(), sorted.end());
+		double median = sorted[windows / 2];
+		std::vector<double> deviation;
+		for (int w = 0; w < windows; w++) {
+			deviation.push_back(fabs(factor[w] - median));
 		}
+		std::sort(deviation.begin(), deviation.end());
+		double mad = deviation[windows / 2];
+
+		double sum = 0, squares = 0;
+		int kept = 0;
+		for (int w = 0; w < windows; w++) {
+			if (fabs(factor[w] - median) <= 3 * mad) {
+				sum += factor[w];
+				squares += factor[w] * factor[w];
+				kept += 1;
+			}
+		}
+		time_factor = sum / kept;
+		double variance = std::max(0.0, squares / kept - time_factor * time_factor);
+		time_uncertainty = 1 < kept ? sqrt(variance / (kept - 1)) / time_factor : 0;
 	}
-	int64 rtc_finish = read_rtc();
+}
 
-	wall_elapsed = wall_finish - wall_start;
-	rtc_elapsed = rtc_finish - rtc_start;
-	time_factor = wall_elapsed / (double) rtc_elapsed;
+const char* Timer::source() {
+	return use_rtc ? "tsc" : "clock_monotonic_raw";
 }
 
 static double wall_seconds() {
-	struct timeval t;
-	gettimeofday(&t, NULL);
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC_RAW, &t);
 
-	return (double) t.tv_sec + (double) t.tv_usec * 1E-6;
+	return (double) t.tv_sec + (double) t.tv_nsec * 1E-9;
 }
 
 #else
@@ -143,10 +235,153 @@ Timer::calibrate()
 void
 Timer::calibrate(int n)
 {
+	core_frequency = measure_cycles_per_second();
+}
+
+void
+Timer::calibrate(int n, bool reuse)
+{
+	from_cache = reuse && load_calibration();
+	if (from_cache)
+		return;
+
+	Timer::calibrate(n);
+	save_calibration();
+}
+
+const char*
+Timer::source()
+{
+	return "gettimeofday";
 }
 
 #endif
 
+double Timer::cycles_per_second() {
+	return core_frequency;
+}
+
+// relative standard error of the timer rate
+double Timer::uncertainty() {
+	return time_uncertainty;
+}
+
+bool Timer::cached() {
+	return from_cache;
+}
+
+// calibrations are cached per user, in $XDG_CACHE_HOME
+// or ~/.cache, and only hold until the next boot
+static bool cache_file(char* path, size_t size) {
+	const char* dir = getenv("XDG_CACHE_HOME");
+	if (dir != NULL && *dir != '\0') {
+		snprintf(path, size, "%s/pchase-timer", dir);
+	} else if ((dir = getenv("HOME")) != NULL && *dir != '\0') {
+		snprintf(path, size, "%s/.cache", dir);
+		mkdir(path, 0700);
+		snprintf(path, size, "%s/.cache/pchase-timer", dir);
+	} else {
+		return false;
+	}
+
+	return true;
+}
+
+// the key of a calibration: the boot, the cpu
+// model and the timer source it applies to
+static bool calibration_key(char* key, size_t size) {
+	char boot_id[64] = "";
+	FILE* f = fopen("/proc/sys/kernel/random/boot_id", "r");
+	if (f != NULL) {
+		if (fgets(boot_id, sizeof(boot_id), f) == NULL)
+			boot_id[0] = '\0';
+		boot_id[strcspn(boot_id, "\n")] = '\0';
+		fclose(f);
+	}
+
+	snprintf(key, size, "%s|%s|%s", boot_id, AsmJit::getCpuInfo()->brand,
+			Timer::source());
+
+	return boot_id[0] != '\0';
+}
+
+static bool load_calibration() {
+	char path[4096], key[256], line[512];
+	if (!cache_file(path, sizeof(path)) || !calibration_key(key, sizeof(key)))
+		return false;
+
+	FILE* f = fopen(path, "r");
+	if (f == NULL)
+		return false;
+
+	bool ok = fgets(line, sizeof(line), f) != NULL;
+	line[strcspn(line, "\n")] = '\0';
+	ok = ok && strcmp(line, key) == 0;
+	ok = ok && fscanf(f, "%lf %lf %lf", &time_factor, &time_uncertainty,
+			&core_frequency) == 3;
+	fclose(f);
+
+	return ok;
+}
+
+// replace the cache atomically, so concurrent
+// invocations never read a partial file
+static void save_calibration() {
+	char path[4096], temp[4200], key[256];
+	if (!cache_file(path, sizeof(path)) || !calibration_key(key, sizeof(key)))
+		return;
+	snprintf(temp, sizeof(temp), "%s.%d", path, (int) getpid());
+
+	FILE* f = fopen(temp, "w");
+	if (f == NULL)
+		return;
+	fprintf(f, "%s\n%.17g %.17g %.17g\n", key, time_factor, time_uncertainty,
+			core_frequency);
+	if (fclose(f) != 0 || rename(temp, path) != 0)
+		unlink(temp);
+}
+
+// time a chain of dependent additions, which retire
+// one per core cycle, to find the core clock rate.
+// a register is added to itself, as additions of
+// small constants may be folded at register rename.
+// the fastest of a few runs is used, once the core
+// has left any low power state.
+static double measure_cycles_per_second() {
+	const int64 loops = 1000000;
+	const int64 cycles_per_loop = 10;
+
+	double best = 0;
+	for (int run = 0; run < 5; run++) {
+		int64 count = loops;
+		int64 sum = 0;
+		double start = Timer::seconds();
+		__asm__ __volatile__(
+				"1: ;"
+				"addq %0,%0;"
+				"addq %0,%0;"
+				"addq %0,%0;"
+				"addq %0,%0;"
+				"addq %0,%0;"
+				"addq %0,%0;"
+				"addq %0,%0;"
+				"addq %0,%0;"
+				"addq %0,%0;"
+				"addq %0,%0;"
+				"decq %1;"
+				"jnz 1b;"
+				: "+r"(sum), "+r"(count)
+				:
+				: "cc"
+		);
+		double elapsed = Timer::seconds() - start;
+		if (0 < elapsed && best < loops * cycles_per_loop / elapsed)
+			best = loops * cycles_per_loop / elapsed;
+	}
+
+	return best;
+}
+
 static double min(double v1, double v2) {
 	if (v2 < v1)
 		return v2;
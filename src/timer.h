@@ -33,6 +33,11 @@ public:
 	static int64 ticks();
 	static void calibrate();
 	static void calibrate(int n);
+	static void calibrate(int n, bool reuse);
+	static double cycles_per_second();
+	static double uncertainty();
+	static bool cached();
+	static const char* source();
 private:
 };
 
@@ -0,0 +1,142 @@
+/*******************************************************************************
+ * Copyright (c) 2006 International Business Machines Corporation.             *
+ * All rights reserved. This program and the accompanying materials            *
+ * are made available under the terms of the Common Public License v1.0        *
+ * which accompanies this distribution, and is available at                    *
+ * http://www.opensource.org/licenses/cpl1.0.php                               *
+ *                                                                             *
+ * Contributors:                                                               *
+ *    Douglas M. Pase - initial API and implementation                         *
+ *    Tim Besard - prefetching, JIT compilation                                *
+ *******************************************************************************/
+
+//
+// Configuration
+//
+
+// Implementation header
+#include "topology.h"
+
+// System includes
+#include <cstdio>
+#include <sched.h>
+#include <algorithm>
+
+
+//
+// Implementation
+//
+
+static bool by_socket(int32 a, int32 b) {
+	return Topology::socket(a) < Topology::socket(b);
+}
+
+// a list of numbers and ranges such as "0-3,5" read from
+// a file of sysfs, empty when the file cannot be read
+static std::vector<int32> read_list(const char* path) {
+	std::vector<int32> result;
+	FILE* f = fopen(path, "r");
+	if (f != NULL) {
+		int32 first, last;
+		while (fscanf(f, "%d", &first) == 1) {
+			last = first;
+			int c = fgetc(f);
+			if (c == '-') {
+				if (fscanf(f, "%d", &last) != 1)
+					break;
+				c = fgetc(f);
+			}
+			for (int32 i = first; i <= last; i++) {
+				result.push_back(i);
+			}
+			if (c != ',')
+				break;
+		}
+		fclose(f);
+	}
+
+	return result;
+}
+
+// the cpus this process may run on,
+// socket by socket in increasing order
+std::vector<int32> Topology::cpus() {
+	cpu_set_t cs;
+	CPU_ZERO(&cs);
+	sched_getaffinity(0, sizeof(cs), &cs);
+
+	std::vector<int32> result;
+	for (int32 cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+		if (CPU_ISSET(cpu, &cs))
+			result.push_back(cpu);
+	}
+	std::stable_sort(result.begin(), result.end(), by_socket);
+
+	return result;
+}
+
+// the socket (physical package) of a cpu,
+// or zero when the topology is not known
+int32 Topology::socket(int32 cpu) {
+	char path[128];
+	snprintf(path, sizeof(path),
+			"/sys/devices/system/cpu/cpu%d/topology/physical_package_id", cpu);
+
+	int32 result = 0;
+	FILE* f = fopen(path, "r");
+	if (f != NULL) {
+		if (fscanf(f, "%d", &result) != 1 || result < 0)
+			result = 0;
+		fclose(f);
+	}
+
+	return result;
+}
+
+// the number of sockets this process may run on
+int32 Topology::sockets() {
+	std::vector<int32> cpus = Topology::cpus();
+	int32 result = 0;
+	for (size_t i = 0; i < cpus.size(); i++) {
+		if (i == 0 || Topology::socket(cpus[i]) != Topology::socket(cpus[i-1]))
+			result += 1;
+	}
+
+	return result;
+}
+
+// the numa nodes below <domains> that have cpus, excluding
+// memory-only nodes such as cxl expanders, read from the node
+// list in /sys/devices/system/node/has_cpu ("0-3,5"), or all
+// of them when the list is not known
+std::vector<int32> Topology::cpu_nodes(int32 domains) {
+	std::vector<int32> nodes = read_list("/sys/devices/system/node/has_cpu");
+	std::vector<int32> result;
+	for (size_t i = 0; i < nodes.size(); i++) {
+		if (nodes[i] < domains)
+			result.push_back(nodes[i]);
+	}
+	if (result.empty()) {
+		for (int32 node = 0; node < domains; node++) {
+			result.push_back(node);
+		}
+	}
+
+	return result;
+}
+
+// the first other hardware thread of the core of a cpu,
+// read from its thread_siblings_list, or -1 without smt
+int32 Topology::sibling(int32 cpu) {
+	char path[128];
+	snprintf(path, sizeof(path),
+			"/sys/devices/system/cpu/cpu%d/topology/thread_siblings_list", cpu);
+
+	std::vector<int32> siblings = read_list(path);
+	for (size_t i = 0; i < siblings.size(); i++) {
+		if (siblings[i] != cpu)
+			return siblings[i];
+	}
+
+	return -1;
+}
@@ -0,0 +1,42 @@
+/*******************************************************************************
+ * Copyright (c) 2006 International Business Machines Corporation.             *
+ * All rights reserved. This program and the accompanying materials            *
+ * are made available under the terms of the Common Public License v1.0        *
+ * which accompanies this distribution, and is available at                    *
+ * http://www.opensource.org/licenses/cpl1.0.php                               *
+ *                                                                             *
+ * Contributors:                                                               *
+ *    Douglas M. Pase - initial API and implementation                         *
+ *    Tim Besard - prefetching, JIT compilation                                *
+ *******************************************************************************/
+
+//
+// Configuration
+//
+
+// Include guard
+#if !defined(TOPOLOGY_H)
+#define TOPOLOGY_H
+
+// System includes
+#include <vector>
+
+// Local includes
+#include "types.h"
+
+
+//
+// Class definition
+//
+
+class Topology {
+public:
+	static std::vector<int32> cpus();
+	static int32 socket(int32 cpu);
+	static int32 sockets();
+	static std::vector<int32> cpu_nodes(int32 domains);
+	static int32 sibling(int32 cpu);
+private:
+};
+
+#endif